@@ -10,20 +10,27 @@
 #define QUIVER_HPP_INCLUDED
 
 #include <quiver/adjacency_list.hpp>
+#include <quiver/arena.hpp>
+#include <quiver/build.hpp>
 #include <quiver/connected_components.hpp>
 #include <quiver/container_traits.hpp>
+#include <quiver/contraction_hierarchy.hpp>
+#include <quiver/csr_graph.hpp>
 #include <quiver/disjoint_set.hpp>
 #include <quiver/dot.hpp>
 #include <quiver/exception.hpp>
 #include <quiver/families.hpp>
+#include <quiver/hash_indexed_vector.hpp>
 #include <quiver/heaps.hpp>
 #include <quiver/mst.hpp>
 #include <quiver/operations.hpp>
 #include <quiver/orientation.hpp>
 #include <quiver/properties.hpp>
 #include <quiver/regular.hpp>
+#include <quiver/reverse_index.hpp>
 #include <quiver/search.hpp>
 #include <quiver/strongly_connected_components.hpp>
+#include <quiver/thread_pool.hpp>
 #include <quiver/toposort.hpp>
 #include <quiver/typedefs.hpp>
 #include <quiver/util.hpp>
@@ -16,46 +16,155 @@
 #include <utility>
 #include <cstddef>
 #include <algorithm>
+#include <iterator>
+#include <compare>
+#include <ranges>
+#include <vector>
 
 namespace quiver
 {
-	template<typename edge_properties_t>
+	template<typename edge_properties_t, typename index_t = vertex_index_t>
 	struct out_edge : public void2empty<edge_properties_t>
 	{
+		static_assert(std::is_unsigned_v<index_t>, "index_t must be an unsigned integer type");
+
 		using base_t = void2empty<edge_properties_t>;
-		vertex_index_t to;
+		using vertex_index_type = index_t;
+		vertex_index_type to;
 
 		base_t const& properties() const noexcept	{ return *this; }
 		base_t      & properties()       noexcept	{ return *this; }
 
 		template<typename... args_t>
-		constexpr out_edge(vertex_index_t to, args_t&&... args) noexcept(std::is_nothrow_constructible_v<base_t, args_t...>)
+		constexpr out_edge(vertex_index_type to, args_t&&... args) noexcept(std::is_nothrow_constructible_v<base_t, args_t...>)
 		: base_t(std::forward<args_t>(args)...), to(to)
 		{
 		}
 	};
-	template<typename edge_properties_t>
+	template<typename edge_properties_t, typename index_t = vertex_index_t>
 	struct edge : public void2empty<edge_properties_t>
 	{
+		static_assert(std::is_unsigned_v<index_t>, "index_t must be an unsigned integer type");
+
 		using base_t = void2empty<edge_properties_t>;
-		vertex_index_t from, to;
+		using vertex_index_type = index_t;
+		vertex_index_type from, to;
 
 		base_t const& properties() const noexcept	{ return *this; }
 		base_t      & properties()       noexcept	{ return *this; }
 
 		template<typename... args_t>
-		constexpr edge(vertex_index_t from, vertex_index_t to, args_t&&... args) noexcept(std::is_nothrow_constructible_v<base_t, args_t...>)
+		constexpr edge(vertex_index_type from, vertex_index_type to, args_t&&... args) noexcept(std::is_nothrow_constructible_v<base_t, args_t...>)
 		: base_t(std::forward<args_t>(args)...), from(from), to(to)
 		{
 		}
-		constexpr edge(vertex_index_t from, out_edge<edge_properties_t> out) noexcept(std::is_nothrow_move_constructible_v<base_t>)
+		constexpr edge(vertex_index_type from, out_edge<edge_properties_t, index_t> out) noexcept(std::is_nothrow_move_constructible_v<base_t>)
 		: base_t(std::move(out.properties())), from(from), to(out.to)
 		{
 		}
 	};
 
-	template<typename vertex_properties_t, typename out_edge_list_t>
-	struct vertex : public void2empty<vertex_properties_t>
+	// an entry of the in-edge index: the vertex the edge comes from; its properties are those of the out_edge
+	template<typename index_t = vertex_index_t>
+	struct in_edge
+	{
+		static_assert(std::is_unsigned_v<index_t>, "index_t must be an unsigned integer type");
+
+		using vertex_index_type = index_t;
+		vertex_index_type from;
+
+		constexpr in_edge(vertex_index_type from) noexcept
+		: from(from)
+		{
+		}
+	};
+
+	// the in_edge_container of the graphs without an in-edge index
+	template<typename T>
+	using no_in_edges = void;
+
+	namespace detail
+	{
+		template<typename out_edge_list_t>
+		constexpr auto out_edge_lower_bound(out_edge_list_t& out_edges, vertex_index_t index) noexcept
+		{
+			return std::partition_point(out_edges.begin(), out_edges.end(), [index](auto const& edge){ return edge.to < index; });
+		}
+		template<typename out_edge_list_t>
+		constexpr auto find_out_edge(out_edge_list_t& out_edges, vertex_index_t index) noexcept
+		{
+			constexpr lookup_t lookup = container_lookup_v<std::remove_const_t<out_edge_list_t>>;
+			if constexpr(lookup == lookup_t::binary_search) {
+				const auto iter = out_edge_lower_bound(out_edges, index);
+				return iter != out_edges.end() && iter->to == index ? iter : out_edges.end();
+			} else if constexpr(lookup == lookup_t::hash) {
+				return out_edges.find(index);
+			} else {
+				return std::find_if(out_edges.begin(), out_edges.end(), [index](auto const& edge){ return edge.to == index; });
+			}
+		}
+		// a hash index over out_edges has to be suspended while the targets of the edges are changed in place
+		template<typename out_edge_list_t>
+		void out_edges_unindex(out_edge_list_t& out_edges) noexcept
+		{
+			if constexpr(container_lookup_v<out_edge_list_t> == lookup_t::hash)
+				out_edges.unindex();
+		}
+		template<typename out_edge_list_t>
+		void out_edges_reindex(out_edge_list_t& out_edges)
+		{
+			if constexpr(container_lookup_v<out_edge_list_t> == lookup_t::hash)
+				out_edges.reindex();
+		}
+		// erases the elements for which predicate holds in one pass, unlike repeated erasure of single elements;
+		// returns their number
+		template<typename edge_list_t, typename predicate_t>
+		std::size_t edges_erase_if(edge_list_t& edges, predicate_t predicate)
+		{
+			if constexpr(requires { edges.erase(edges.begin(), edges.end()); }) {
+				const auto first = std::remove_if(edges.begin(), edges.end(), predicate);
+				const std::size_t count = static_cast<std::size_t>(std::distance(first, edges.end()));
+				edges.erase(first, edges.end());
+				return count;
+			} else {
+				std::size_t count = 0;
+				for(auto iter = edges.begin(); iter != edges.end();) {
+					if(predicate(*iter)) {
+						iter = edges.erase(iter);
+						++count;
+					} else {
+						++iter;
+					}
+				}
+				return count;
+			}
+		}
+
+		// an operation of E.emplace_batch or E.erase_batch on the out-edges of from; position is that of the edge in
+		// the batch, so that sorting the entries groups them by source and keeps the first of duplicates in front
+		struct edge_batch_entry_t
+		{
+			vertex_index_t from, to;
+			std::size_t position;
+
+			auto operator<=>(edge_batch_entry_t const&) const = default;
+		};
+
+		template<typename in_edge_list_t>
+		struct vertex_in_edges
+		{
+			in_edge_list_t in_edges;
+
+			std::size_t in_degree() const noexcept		{ return in_edges.size(); }
+		};
+		template<>
+		struct vertex_in_edges<void>
+		{
+		};
+	}
+
+	template<typename vertex_properties_t, typename out_edge_list_t, typename in_edge_list_t = void>
+	struct vertex : public void2empty<vertex_properties_t>, public detail::vertex_in_edges<in_edge_list_t>
 	{
 		using base_t = void2empty<vertex_properties_t>;
 		out_edge_list_t out_edges;
@@ -65,14 +174,17 @@ namespace quiver
 
 		std::size_t out_degree() const noexcept		{ return out_edges.size(); }
 
+		// the out-edge to index or out_edges.end(), by a binary search if out_edges is a sorted_vector
+		constexpr auto find_edge_to(vertex_index_t index) const noexcept	{ return detail::find_out_edge(out_edges, index); }
+		constexpr auto find_edge_to(vertex_index_t index) noexcept			{ return detail::find_out_edge(out_edges, index); }
 		constexpr bool has_edge_to(vertex_index_t index) const noexcept
 		{
-			return std::any_of(out_edges.begin(), out_edges.end(), [index](auto const& edge){ return edge.to == index; });
+			return find_edge_to(index) != out_edges.end();
 		}
 
 		constexpr void sort_edges()
 		{
-			sort(out_edges, [](auto const& x, auto const& y){ return x.to < y.to; });
+			container_traits<out_edge_list_t>{}.sort(out_edges, [](auto const& x, auto const& y){ return x.to < y.to; });
 		}
 
 		using base_t::base_t;
@@ -86,8 +198,39 @@ namespace quiver
 		}
 	};
 
+	// Writes the vertices to which both lhs and rhs have an edge to output. If both keep their out-edges in a
+	// sorted_vector, they are merged in O(out_degree(lhs) + out_degree(rhs)) and written in ascending order;
+	// otherwise every out-edge of lhs is looked up in rhs, and they are written in the order of lhs.
+	template<typename vertex_t, typename output_iterator_t>
+	output_iterator_t common_out_neighbors(vertex_t const& lhs, vertex_t const& rhs, output_iterator_t output)
+	{
+		if constexpr(is_sorted_container<decltype(lhs.out_edges)>) {
+			auto left = lhs.out_edges.begin();
+			auto right = rhs.out_edges.begin();
+			while(left != lhs.out_edges.end() && right != rhs.out_edges.end()) {
+				if(left->to < right->to) {
+					++left;
+				} else if(right->to < left->to) {
+					++right;
+				} else {
+					*output++ = vertex_index_t(left->to);
+					++left;
+					++right;
+				}
+			}
+		} else {
+			for(auto const& out_edge : lhs.out_edges)
+				if(rhs.has_edge_to(out_edge.to))
+					*output++ = vertex_index_t(out_edge.to);
+		}
+		return output;
+	}
+
 	namespace detail
 	{
+		// fills adjacency_lists from edge lists, see build_from_edges
+		struct edge_list_builder;
+
 		template<typename adjacency_list_t, typename intermediate_t>
 		class vertex_span_t final
 		{
@@ -134,6 +277,9 @@ namespace quiver
 			template<typename... args_t>
 			constexpr auto emplace(args_t&&... args) { return get_parent()->vertex_emplace(std::forward<args_t>(args)...); }
 			constexpr auto erase(vertex_index_t index) { return get_parent()->vertex_erase(index); }
+			constexpr auto erase(std::ranges::input_range auto const& indices) { return get_parent()->vertex_erase_all(indices); }
+			template<typename predicate_t>
+			constexpr auto erase_if(predicate_t predicate) { return get_parent()->vertex_erase_if(std::move(predicate)); }
 		};
 
 		template<typename adjacency_list_t, typename intermediate_t>
@@ -187,6 +333,8 @@ namespace quiver
 			template<typename... args_t>
 			constexpr auto emplace(vertex_index_t from, vertex_index_t to, args_t&&... args) { return get_parent()->edge_emplace(from, to, std::forward<args_t>(args)...); }
 			constexpr auto erase(vertex_index_t from, vertex_index_t to) { return get_parent()->edge_erase(from, to); }
+			constexpr auto emplace_batch(std::ranges::random_access_range auto const& edges) { return get_parent()->edge_emplace_batch(edges); }
+			constexpr auto erase_batch(std::ranges::input_range auto const& edges) { return get_parent()->edge_erase_batch(edges); }
 		};
 
 		// We need this base class because we need a standard layout type for offsetof.
@@ -196,6 +344,8 @@ namespace quiver
 			typename vertex_properties_t,
 			template<typename> class out_edge_container,
 			template<typename> class vertex_container,
+			typename index_t,
+			template<typename> class in_edge_container,
 			typename derived_t
 		>
 		class adjacency_list_base
@@ -205,11 +355,13 @@ namespace quiver
 				typename rhs_vertex_properties_t,
 				template<typename> class rhs_out_edge_container,
 				template<typename> class rhs_vertex_container,
+				typename rhs_index_t,
+				template<typename> class rhs_in_edge_container,
 				typename rhs_derived_t
 			>
 			friend class adjacency_list_base;
 
-			using vertices_t = vertex_container<::quiver::vertex<vertex_properties_t, out_edge_container<out_edge<edge_properties_t>>>>;
+			using vertices_t = vertex_container<::quiver::vertex<vertex_properties_t, out_edge_container<out_edge<edge_properties_t, index_t>>, in_edge_container<in_edge<index_t>>>>;
 			using adjacency_list = derived_t;
 			using vertex_span_type = vertex_span_t<adjacency_list, adjacency_list_base>;
 			friend vertex_span_type;
@@ -247,9 +399,11 @@ namespace quiver
 				typename rhs_vertex_properties_t,
 				template<typename> class rhs_out_edge_container,
 				template<typename> class rhs_vertex_container,
+				typename rhs_index_t,
+				template<typename> class rhs_in_edge_container,
 				typename rhs_derived_t
 			>
-			adjacency_list_base(adjacency_list_base<rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, rhs_derived_t> const& rhs)
+			adjacency_list_base(adjacency_list_base<rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, rhs_index_t, rhs_in_edge_container, rhs_derived_t> const& rhs)
 			: m_v(rhs.m_v), m_e(rhs.m_e), m_vertices(rhs.m_vertices)
 			{
 			}
@@ -258,9 +412,11 @@ namespace quiver
 				typename rhs_vertex_properties_t,
 				template<typename> class rhs_out_edge_container,
 				template<typename> class rhs_vertex_container,
+				typename rhs_index_t,
+				template<typename> class rhs_in_edge_container,
 				typename rhs_derived_t
 			>
-			adjacency_list_base(adjacency_list_base<rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, rhs_derived_t>&& rhs) noexcept
+			adjacency_list_base(adjacency_list_base<rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, rhs_index_t, rhs_in_edge_container, rhs_derived_t>&& rhs) noexcept
 			: m_v(std::move(rhs.m_v)), m_e(std::move(rhs.m_e)), m_vertices(std::move(rhs.m_vertices))
 			{
 			}
@@ -280,37 +436,55 @@ namespace quiver
 	}
 
 	// no loops, no multiedges
+	// With out_edge_container = sorted_vector, the out-edges of every vertex are kept sorted by their target, which
+	// makes E(from, to), E.emplace, E.erase and has_edge_to binary searches, see common_out_neighbors. With
+	// hash_indexed_vector, they are hash lookups for the vertices whose degree exceeds its threshold.
+	// Directed graphs whose in_edge_container is a container, e.g. vector, keep an in-edge index: every vertex
+	// lists the vertices with an edge to it in .in_edges, which E.emplace, E.erase and V.erase maintain, such that
+	// in_degree takes O(1). Edges must then only be added and removed through E and V, not through .out_edges.
 	template<
 		directivity_t dir = directed,
 		typename edge_properties_t = void,
 		typename vertex_properties_t = void,
 		template<typename> class out_edge_container = vector,
-		template<typename> class vertex_container = vector
+		template<typename> class vertex_container = vector,
+		typename index_t = vertex_index_t,
+		template<typename> class in_edge_container = no_in_edges
 	>
-	class adjacency_list : private detail::adjacency_list_base<edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>>
+	class adjacency_list : private detail::adjacency_list_base<edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container, adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>>
 	{
 		template<
 			directivity_t rhs_dir,
 			typename rhs_edge_properties_t,
 			typename rhs_vertex_properties_t,
 			template<typename> class rhs_out_edge_container,
-			template<typename> class rhs_vertex_container
+			template<typename> class rhs_vertex_container,
+			typename rhs_index_t,
+			template<typename> class rhs_in_edge_container
 		>
 		friend class adjacency_list;
+		friend struct detail::edge_list_builder;
 
-		using base_t = detail::adjacency_list_base<edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, adjacency_list>;
+		using base_t = detail::adjacency_list_base<edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container, adjacency_list>;
 
 	public:
-		using edge_t = edge<edge_properties_t>;
-		using out_edge_t = out_edge<edge_properties_t>;
+		using vertex_index_type = index_t;
+		using edge_t = edge<edge_properties_t, vertex_index_type>;
+		using out_edge_t = out_edge<edge_properties_t, vertex_index_type>;
 		using out_edge_list_t = out_edge_container<out_edge_t>;
 		static_assert(is_sane_container<out_edge_list_t>, "out_edge_list_t must be sane container");
 
-		using vertex_t = ::quiver::vertex<vertex_properties_t, out_edge_list_t>;
+		using in_edge_t = in_edge<vertex_index_type>;
+		using in_edge_list_t = in_edge_container<in_edge_t>;
+		static_assert(std::is_void_v<in_edge_list_t> || is_sane_container<in_edge_list_t>, "in_edge_list_t must be sane container");
+
+		using vertex_t = ::quiver::vertex<vertex_properties_t, out_edge_list_t, in_edge_list_t>;
 		using vertices_t = vertex_container<vertex_t>;
 		static_assert(is_sane_container<vertices_t>, "vertices_t must be sane container");
 
 		inline static constexpr directivity_t directivity = dir;
+		inline static constexpr bool has_in_edges = !std::is_void_v<in_edge_list_t>;
+		static_assert(!has_in_edges || directivity == directed, "in-edge indices are only kept for directed graphs");
 
 	private:
 		template<
@@ -318,17 +492,21 @@ namespace quiver
 			typename rhs_edge_properties_t,
 			typename rhs_vertex_properties_t,
 			template<typename> class rhs_out_edge_container,
-			template<typename> class rhs_vertex_container
+			template<typename> class rhs_vertex_container,
+			typename rhs_index_t,
+			template<typename> class rhs_in_edge_container
 		>
-		explicit adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container> const& rhs);
+		explicit adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, rhs_index_t, rhs_in_edge_container> const& rhs);
 		template<
 			directivity_t rhs_dir,
 			typename rhs_edge_properties_t,
 			typename rhs_vertex_properties_t,
 			template<typename> class rhs_out_edge_container,
-			template<typename> class rhs_vertex_container
+			template<typename> class rhs_vertex_container,
+			typename rhs_index_t,
+			template<typename> class rhs_in_edge_container
 		>
-		explicit adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container>&& rhs) noexcept;
+		explicit adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, rhs_index_t, rhs_in_edge_container>&& rhs) noexcept;
 
 		using base_t::m_v;
 		static_assert(std::is_same_v<decltype(m_v), std::size_t>);
@@ -359,6 +537,11 @@ namespace quiver
 		vertex_index_t vertex_emplace(args_t&&... args); // TODO: should return iter
 		bool vertex_erase(vertex_index_t index);
 		bool vertex_erase_simple(vertex_index_t index);
+		// erase many vertices by one compaction of the vertices and one pass over the edges, instead of one of
+		// each per vertex; return the map from old to new indices, with inf<vertex_index_t> for the erased ones
+		std::vector<vertex_index_t> vertex_erase_all(std::ranges::input_range auto const& indices);
+		template<typename predicate_t>
+		std::vector<vertex_index_t> vertex_erase_if(predicate_t predicate);
 
 		// accessible through .E
 		constexpr std::size_t edge_size() const noexcept;
@@ -376,6 +559,13 @@ namespace quiver
 		bool edge_emplace_simple(vertex_index_t from, vertex_index_t to, args_t&&... args);
 		bool edge_erase(vertex_index_t from, vertex_index_t to);
 		bool edge_erase_simple(vertex_index_t from, vertex_index_t to);
+		// apply many E.emplace or E.erase at once: the edges are sorted by source and every touched list of
+		// out-edges is matched against its part of the batch in one pass; return the number of edges emplaced or erased
+		std::size_t edge_emplace_batch(std::ranges::random_access_range auto const& edges);
+		std::size_t edge_erase_batch(std::ranges::input_range auto const& edges);
+
+		// fills the in-edge index from the out-edges, after operations which rewrite them wholesale
+		void in_edges_rebuild();
 
 	public:
 		adjacency_list() noexcept = default;
@@ -398,11 +588,11 @@ namespace quiver
 		adjacency_list strip_edges() const&;
 		adjacency_list&& strip_edges() &&;
 
-		adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> to_directed() const&;
-		adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> to_directed() &&;
+		adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container> to_directed() const&;
+		adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container> to_directed() &&;
 
-		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> to_undirected() const&;
-		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> to_undirected() &&;
+		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> to_undirected() const&;
+		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> to_undirected() &&;
 
 		template<typename invokable_t>
 		void transform_outs(invokable_t invokable);
@@ -418,8 +608,8 @@ namespace quiver
 		static constexpr bool is_simple() noexcept;
 	};
 
-	template<directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-	void swap(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& lhs, adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& rhs) noexcept;
+	template<directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+	void swap(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container> const& lhs, adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container> const& rhs) noexcept;
 }
 
 #include <quiver/adjacency_list.inl>
@@ -12,104 +12,116 @@
 #include <quiver/util.hpp>
 #include <quiver/properties.hpp>
 #include <quiver/container_traits.hpp>
+#include <algorithm>
 #include <utility>
+#include <vector>
 #include <cassert>
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-template<quiver::directivity_t rhs_dir, typename rhs_edge_properties_t, typename rhs_vertex_properties_t, template<typename> class rhs_out_edge_container, template<typename> class rhs_vertex_container>
-quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container> const& rhs)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+template<quiver::directivity_t rhs_dir, typename rhs_edge_properties_t, typename rhs_vertex_properties_t, template<typename> class rhs_out_edge_container, template<typename> class rhs_vertex_container, typename rhs_index_t, template<typename> class rhs_in_edge_container>
+quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, rhs_index_t, rhs_in_edge_container> const& rhs)
 : base_t(rhs)
 {
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-template<quiver::directivity_t rhs_dir, typename rhs_edge_properties_t, typename rhs_vertex_properties_t, template<typename> class rhs_out_edge_container, template<typename> class rhs_vertex_container>
-quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container>&& rhs) noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+template<quiver::directivity_t rhs_dir, typename rhs_edge_properties_t, typename rhs_vertex_properties_t, template<typename> class rhs_out_edge_container, template<typename> class rhs_vertex_container, typename rhs_index_t, template<typename> class rhs_in_edge_container>
+quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::adjacency_list(adjacency_list<rhs_dir, rhs_edge_properties_t, rhs_vertex_properties_t, rhs_out_edge_container, rhs_vertex_container, rhs_index_t, rhs_in_edge_container>&& rhs) noexcept
 : base_t(std::move(rhs))
 {
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::normalize(vertex_index_t& from, vertex_index_t& to) noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::normalize(vertex_index_t& from, vertex_index_t& to) noexcept
 {
 	if(from > to)
 		std::swap(from, to);
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_size() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_size() const noexcept
 {
 	return m_vertices.size();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_empty() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_empty() const noexcept
 {
 	return V.size() == 0;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_capacity() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_capacity() const noexcept
 {
 	return m_vertices.capacity();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_reserve(std::size_t vertices)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_reserve(std::size_t vertices)
 {
 	m_vertices.reserve(vertices);
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_begin() noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_begin() noexcept
 {
 	return m_vertices.begin();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_begin() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_begin() const noexcept
 {
 	return m_vertices.begin();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_cbegin() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_cbegin() const noexcept
 {
 	return m_vertices.cbegin();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_end() noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_end() noexcept
 {
 	return m_vertices.end();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_end() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_end() const noexcept
 {
 	return m_vertices.end();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_cend() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_cend() const noexcept
 {
 	return m_vertices.cend();
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_get(vertex_index_t index) const noexcept -> vertex_t const&
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_get(vertex_index_t index) const noexcept -> vertex_t const&
 {
 	assert(index < V.size());
 	return m_vertices[index];
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_get(vertex_index_t index) noexcept -> vertex_t&
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_get(vertex_index_t index) noexcept -> vertex_t&
 {
 	return const_cast<vertex_t&>(static_cast<adjacency_list const&>(*this).vertex_get(index));
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
 template<typename... args_t>
-quiver::vertex_index_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_emplace(args_t&&... args)
+quiver::vertex_index_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_emplace(args_t&&... args)
 {
 	m_vertices.emplace_back(std::forward<args_t>(args)...);
 	// assert(directivity == directed || m_vertices.back().out_edges.empty()); // we mustn't have this check for split_ccs
 	m_e += m_vertices.back().out_edges.size();
+	if constexpr(is_sorted_container<out_edge_list_t>)
+		m_vertices.back().sort_edges();
+	if constexpr(has_in_edges) {
+		// the vertex may be a copy of another one, whose in-edges it doesn't have
+		m_vertices.back().in_edges.clear();
+		for(auto const& out_edge : m_vertices.back().out_edges) {
+			assert(out_edge.to < m_v); // the edges of a new vertex can only lead to existing ones
+			m_vertices[out_edge.to].in_edges.emplace_back(static_cast<index_t>(m_v));
+		}
+	}
 	return m_v++;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_erase(vertex_index_t index)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_erase(vertex_index_t index)
 {
 	assert(index < V.size());
 
@@ -117,12 +129,12 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	{
 		for(auto& vertex : m_vertices)
 		{
+			detail::out_edges_unindex(vertex.out_edges);
 			for(std::size_t i = vertex.out_edges.size(); i-- > 0;)
 			{
 				if(vertex.out_edges[i].to == index)
 				{
 					vertex.out_edges.erase(vertex.out_edges.begin() + i);
-					++i;
 					--m_e;
 				}
 				else if(vertex.out_edges[i].to > index)
@@ -130,6 +142,17 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 					--vertex.out_edges[i].to;
 				}
 			}
+			if constexpr(has_in_edges)
+			{
+				for(std::size_t i = vertex.in_edges.size(); i-- > 0;)
+				{
+					if(vertex.in_edges[i].from == index)
+						vertex.in_edges.erase(vertex.in_edges.begin() + i);
+					else if(vertex.in_edges[i].from > index)
+						--vertex.in_edges[i].from;
+				}
+			}
+			detail::out_edges_reindex(vertex.out_edges);
 		}
 		return true;
 	}
@@ -138,8 +161,8 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 		return false;
 	}
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::vertex_erase_simple(vertex_index_t index)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_erase_simple(vertex_index_t index)
 {
 	assert(index < V.size());
 
@@ -149,22 +172,70 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	--m_v;
 	return true;
 }
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+std::vector<quiver::vertex_index_t> quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_erase_all(std::ranges::input_range auto const& indices)
+{
+	std::vector<bool> erase(m_vertices.size(), false);
+	for(vertex_index_t index : indices)
+	{
+		assert(index < V.size());
+		erase[index] = true;
+	}
+	return vertex_erase_if([&erase](vertex_index_t index){ return erase[index]; });
+}
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+template<typename predicate_t>
+std::vector<quiver::vertex_index_t> quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::vertex_erase_if(predicate_t predicate)
+{
+	std::vector<vertex_index_t> remap(m_vertices.size());
+	vertex_index_t kept = 0;
+	for(vertex_index_t index = 0; index < remap.size(); ++index)
+		remap[index] = predicate(index) ? inf<vertex_index_t> : kept++;
+	if(kept == m_vertices.size())
+		return remap;
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_size() const noexcept
+	for(vertex_index_t index = 0; index < remap.size(); ++index)
+	{
+		if(remap[index] == inf<vertex_index_t>)
+			m_e -= m_vertices[index].out_degree();
+		else if(remap[index] != index)
+			m_vertices[remap[index]] = std::move(m_vertices[index]);
+	}
+	m_vertices.erase(m_vertices.begin() + kept, m_vertices.end());
+	m_v = kept;
+
+	for(auto& vertex : m_vertices)
+	{
+		detail::out_edges_unindex(vertex.out_edges);
+		m_e -= detail::edges_erase_if(vertex.out_edges, [&remap](auto const& out_edge){ return remap[out_edge.to] == inf<vertex_index_t>; });
+		for(auto& out_edge : vertex.out_edges)
+			out_edge.to = static_cast<index_t>(remap[out_edge.to]);
+		if constexpr(has_in_edges)
+		{
+			detail::edges_erase_if(vertex.in_edges, [&remap](auto const& in_edge){ return remap[in_edge.from] == inf<vertex_index_t>; });
+			for(auto& in_edge : vertex.in_edges)
+				in_edge.from = static_cast<index_t>(remap[in_edge.from]);
+		}
+		detail::out_edges_reindex(vertex.out_edges);
+	}
+	return remap;
+}
+
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::edge_size() const noexcept
 {
 	if constexpr(directivity == directed)
 		return m_e;
 	else if constexpr(directivity == undirected)
 		return m_e / 2;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_empty() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::edge_empty() const noexcept
 {
 	return E.size() == 0;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_max_size() const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::edge_max_size() const noexcept
 {
 	if constexpr(directivity == directed)
 		return V.size() * (V.size() - 1);
@@ -172,8 +243,8 @@ constexpr std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_prop
 		return V.size() * (V.size() - 1) / 2;
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_get(vertex_index_t from, vertex_index_t to) const noexcept -> out_edge_t const*
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::edge_get(vertex_index_t from, vertex_index_t to) const noexcept -> out_edge_t const*
 {
 	assert(from < V.size());
 	assert(to < V.size());
@@ -182,23 +253,21 @@ constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_
 		normalize(from, to); // so that edge_get(1,0) == edge_get(0,1)
 	return edge_get_simple(from, to);
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_get_simple(vertex_index_t from, vertex_index_t to) const noexcept -> out_edge_t const*
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::edge_get_simple(vertex_index_t from, vertex_index_t to) const noexcept -> out_edge_t const*
 {
 	assert(from < V.size());
 	assert(to < V.size());
 
 	// if(from == to) return nullptr;
-	auto& edges = m_vertices[from].out_edges;
-	for(auto iter = edges.begin(); iter != edges.end(); ++iter)
-		if(iter->to == to)
-			return &*iter;
-	return nullptr;
+	auto const& edges = m_vertices[from].out_edges;
+	const auto iter = detail::find_out_edge(edges, to);
+	return iter != edges.end() ? &*iter : nullptr;
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
 template<typename... args_t>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_emplace(vertex_index_t from, vertex_index_t to, args_t&&... args)
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::edge_emplace(vertex_index_t from, vertex_index_t to, args_t&&... args)
 {
 	assert(from < V.size());
 	assert(to < V.size());
@@ -215,22 +284,28 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	}
 	return true;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
 template<typename... args_t>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_emplace_simple_nonexistent(vertex_index_t from, vertex_index_t to, args_t&&... args)
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::edge_emplace_simple_nonexistent(vertex_index_t from, vertex_index_t to, args_t&&... args)
 {
 	assert(from < V.size());
 	assert(to < V.size());
 	assert(edge_get_simple(from, to) == nullptr);
 	assert(from != to); // no loops
 
-	m_vertices[from].out_edges.emplace_back(to, std::forward<args_t>(args)...);
+	auto& edges = m_vertices[from].out_edges;
+	if constexpr(is_sorted_container<out_edge_list_t>)
+		edges.emplace(detail::out_edge_lower_bound(edges, to), to, std::forward<args_t>(args)...);
+	else
+		edges.emplace_back(to, std::forward<args_t>(args)...);
+	if constexpr(has_in_edges)
+		m_vertices[to].in_edges.emplace_back(static_cast<index_t>(from));
 	++m_e;
 	return true;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
 template<typename... args_t>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_emplace_simple(vertex_index_t from, vertex_index_t to, args_t&&... args)
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::edge_emplace_simple(vertex_index_t from, vertex_index_t to, args_t&&... args)
 {
 	assert(from < V.size());
 	assert(to < V.size());
@@ -241,8 +316,8 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	else
 		return false;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_erase(vertex_index_t from, vertex_index_t to)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::edge_erase(vertex_index_t from, vertex_index_t to)
 {
 	assert(from < V.size());
 	assert(to < V.size());
@@ -261,36 +336,187 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 		return removed;
 	}
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::edge_erase_simple(vertex_index_t from, vertex_index_t to)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::edge_erase_simple(vertex_index_t from, vertex_index_t to)
 {
 	assert(from < V.size());
 	assert(to < V.size());
 
 	// if(from == to) return false;
 	auto& edges = m_vertices[from].out_edges;
-	for(auto iter = edges.begin(); iter != edges.end(); ++iter)
+	const auto iter = detail::find_out_edge(edges, to);
+	if(iter == edges.end())
+		return false;
+
+	edges.erase(iter);
+	if constexpr(has_in_edges)
 	{
-		if(iter->to == to)
+		auto& in_edges = m_vertices[to].in_edges;
+		const auto in_edge = std::find_if(in_edges.begin(), in_edges.end(), [from](auto const& in_edge){ return in_edge.from == from; });
+		assert(in_edge != in_edges.end());
+		in_edges.erase(in_edge);
+	}
+	--m_e;
+	return true;
+}
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::edge_emplace_batch(std::ranges::random_access_range auto const& edges)
+{
+	const auto first = std::ranges::begin(edges);
+	const std::size_t size = std::ranges::size(edges);
+	std::vector<detail::edge_batch_entry_t> entries;
+	entries.reserve(directivity == undirected ? 2 * size : size);
+	for(std::size_t position = 0; position < size; ++position)
+	{
+		auto const& edge = first[position];
+		assert(edge.from < V.size());
+		assert(edge.to < V.size());
+		assert(edge.from != edge.to); // no loops
+		entries.push_back({ edge.from, edge.to, position });
+		if constexpr(directivity == undirected)
+			entries.push_back({ edge.to, edge.from, position });
+	}
+	std::sort(entries.begin(), entries.end());
+	entries.erase(std::unique(entries.begin(), entries.end(), [](auto const& lhs, auto const& rhs){ return lhs.from == rhs.from && lhs.to == rhs.to; }), entries.end());
+
+	std::size_t emplaced = 0;
+	std::vector<bool> exists;
+	for(auto group_begin = entries.begin(); group_begin != entries.end();)
+	{
+		const vertex_index_t from = group_begin->from;
+		const auto group_end = std::find_if(group_begin, entries.end(), [from](auto const& entry){ return entry.from != from; });
+		auto& out_edges = m_vertices[from].out_edges;
+
+		exists.assign(group_end - group_begin, false);
+		if constexpr(container_lookup_v<out_edge_list_t> == lookup_t::hash)
 		{
-			edges.erase(iter);
-			--m_e;
-			return true;
+			for(auto iter = group_begin; iter != group_end; ++iter)
+				exists[iter - group_begin] = out_edges.find(iter->to) != out_edges.end();
 		}
+		else
+		{
+			for(auto const& out_edge : out_edges)
+			{
+				const auto iter = std::lower_bound(group_begin, group_end, out_edge.to, [](auto const& entry, vertex_index_t to){ return entry.to < to; });
+				if(iter != group_end && iter->to == out_edge.to)
+					exists[iter - group_begin] = true;
+			}
+		}
+
+		const std::size_t old_size = out_edges.size();
+		if constexpr(requires { out_edges.reserve(std::size_t{}); })
+			out_edges.reserve(old_size + std::count(exists.begin(), exists.end(), false));
+		for(auto iter = group_begin; iter != group_end; ++iter)
+		{
+			if(exists[iter - group_begin])
+				continue;
+			out_edges.emplace_back(static_cast<index_t>(iter->to), first[iter->position].properties());
+			if constexpr(has_in_edges)
+				m_vertices[iter->to].in_edges.emplace_back(static_cast<index_t>(from));
+			++emplaced;
+		}
+		// both parts are sorted by target
+		if constexpr(is_sorted_container<out_edge_list_t>)
+			std::inplace_merge(out_edges.begin(), out_edges.begin() + old_size, out_edges.end(), [](auto const& lhs, auto const& rhs){ return lhs.to < rhs.to; });
+		group_begin = group_end;
+	}
+	m_e += emplaced;
+	return directivity == undirected ? emplaced / 2 : emplaced;
+}
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::edge_erase_batch(std::ranges::input_range auto const& edges)
+{
+	std::vector<detail::edge_batch_entry_t> entries;
+	for(auto const& edge : edges)
+	{
+		assert(edge.from < V.size());
+		assert(edge.to < V.size());
+		entries.push_back({ edge.from, edge.to, 0 });
+		if constexpr(directivity == undirected)
+			entries.push_back({ edge.to, edge.from, 0 });
+	}
+	std::sort(entries.begin(), entries.end());
+	entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+	std::size_t erased = 0;
+	// the erased edges as (to, from, 0), to remove them from the in-edge index afterwards
+	std::vector<detail::edge_batch_entry_t> erased_in_edges;
+	for(auto group_begin = entries.begin(); group_begin != entries.end();)
+	{
+		const vertex_index_t from = group_begin->from;
+		const auto group_end = std::find_if(group_begin, entries.end(), [from](auto const& entry){ return entry.from != from; });
+		auto& out_edges = m_vertices[from].out_edges;
+
+		if constexpr(container_lookup_v<out_edge_list_t> == lookup_t::hash)
+		{
+			for(auto iter = group_begin; iter != group_end; ++iter)
+			{
+				const auto out_edge = out_edges.find(iter->to);
+				if(out_edge == out_edges.end())
+					continue;
+				out_edges.erase(out_edge);
+				if constexpr(has_in_edges)
+					erased_in_edges.push_back({ iter->to, from, 0 });
+				++erased;
+			}
+		}
+		else
+		{
+			erased += detail::edges_erase_if(out_edges, [&](auto const& out_edge){
+				const auto iter = std::lower_bound(group_begin, group_end, out_edge.to, [](auto const& entry, vertex_index_t to){ return entry.to < to; });
+				if(iter == group_end || iter->to != out_edge.to)
+					return false;
+				if constexpr(has_in_edges)
+					erased_in_edges.push_back({ iter->to, from, 0 });
+				return true;
+			});
+		}
+		group_begin = group_end;
+	}
+
+	if constexpr(has_in_edges)
+	{
+		std::sort(erased_in_edges.begin(), erased_in_edges.end());
+		for(auto group_begin = erased_in_edges.begin(); group_begin != erased_in_edges.end();)
+		{
+			const vertex_index_t to = group_begin->from;
+			const auto group_end = std::find_if(group_begin, erased_in_edges.end(), [to](auto const& entry){ return entry.from != to; });
+			detail::edges_erase_if(m_vertices[to].in_edges, [&](auto const& in_edge){
+				const auto iter = std::lower_bound(group_begin, group_end, in_edge.from, [](auto const& entry, vertex_index_t from){ return entry.to < from; });
+				return iter != group_end && iter->to == in_edge.from;
+			});
+			group_begin = group_end;
+		}
+	}
+	m_e -= erased;
+	return directivity == undirected ? erased / 2 : erased;
+}
+
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::in_edges_rebuild()
+{
+	if constexpr(has_in_edges)
+	{
+		for(auto& vertex : m_vertices)
+			vertex.in_edges.clear();
+		for(vertex_index_t v = 0; v < m_vertices.size(); ++v)
+			for(auto const& out_edge : m_vertices[v].out_edges)
+				m_vertices[out_edge.to].in_edges.emplace_back(static_cast<index_t>(v));
 	}
-	return false;
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::adjacency_list(std::size_t vertices)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::adjacency_list(std::size_t vertices)
 : base_t(vertices)
 {
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::in_degree(vertex_index_t index) const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::in_degree(vertex_index_t index) const noexcept
 {
-	if constexpr(directivity == directed) {
+	if constexpr(has_in_edges) {
+		return V[index].in_degree();
+	} else if constexpr(directivity == directed) {
 		std::size_t count = 0;
 		for(auto const& vertex : m_vertices)
 			count += vertex.has_edge_to(index);
@@ -299,20 +525,20 @@ std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t,
 		return out_degree(index);
 	}
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::out_degree(vertex_index_t index) const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::out_degree(vertex_index_t index) const noexcept
 {
 	return V[index].out_degree();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::degree(vertex_index_t index) const noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+std::size_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::degree(vertex_index_t index) const noexcept
 {
 	static_assert(directivity == undirected, "degree only defined for undirected graphs");
 	return out_degree(index);
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::strip_edges() const& -> adjacency_list
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::strip_edges() const& -> adjacency_list
 {
 	adjacency_list result;
 	result.V.reserve(V.size());
@@ -320,35 +546,37 @@ auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 		result.V.emplace(vertex.properties());
 	return result;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::strip_edges() && -> adjacency_list&&
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::strip_edges() && -> adjacency_list&&
 {
 	for(auto& vertex : m_vertices) {
 		std::size_t diff_e = vertex.out_edges.size();
 		vertex.out_edges.clear();
+		if constexpr(has_in_edges)
+			vertex.in_edges.clear();
 		m_e -= diff_e;
 	}
 	assert(m_e == 0);
 	return std::move(*this);
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::to_directed() const& -> adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::to_directed() const& -> adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>
 {
-	using result_t = adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>;
+	using result_t = adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>;
 	return result_t(*this);
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::to_directed() && -> adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::to_directed() && -> adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>
 {
-	using result_t = adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>;
+	using result_t = adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>;
 	return result_t(std::move(*this));
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::to_undirected() const& -> adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::to_undirected() const& -> adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
 {
-	using result_t = adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>;
+	using result_t = adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>;
 	if constexpr(directivity == directed)
 	{
 		// TODO: enforce that there are no back and forths in the original directed graph. this can be caught by checking emplace's return value
@@ -366,11 +594,16 @@ auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 		return *this;
 	}
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::to_undirected() && -> adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::to_undirected() && -> adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
 {
-	using result_t = adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>;
-	if constexpr(directivity == directed)
+	using result_t = adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>;
+	if constexpr(has_in_edges)
+	{
+		// the vertices of the result have no in-edges, so they can't be taken over
+		return std::as_const(*this).to_undirected();
+	}
+	else if constexpr(directivity == directed)
 	{
 		// TODO: enforce that there are no back and forths in the original directed graph
 		result_t result(std::move(*this));
@@ -385,24 +618,30 @@ auto quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	}
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
 template<typename invokable_t>
-void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::transform_outs(invokable_t invokable)
+void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::transform_outs(invokable_t invokable)
 {
-	for(auto& vertex : m_vertices)
+	for(auto& vertex : m_vertices) {
+		detail::out_edges_unindex(vertex.out_edges);
 		for(auto& out_edge : vertex.out_edges)
 			out_edge.to = invokable(out_edge.to);
+		detail::out_edges_reindex(vertex.out_edges);
+	}
+	if constexpr(is_sorted_container<out_edge_list_t>)
+		sort_edges();
+	in_edges_rebuild();
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::sort_edges()
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::sort_edges()
 {
 	if constexpr(container_traits<out_edge_list_t>::is_ordered)
 		for(auto& vertex : m_vertices)
 			vertex.sort_edges();
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::contract(vertex_index_t u, vertex_index_t v)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::contract(vertex_index_t u, vertex_index_t v)
 {
 	// TODO: this function currently doesn't provide strong exception safety
 
@@ -415,6 +654,8 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 		std::swap(u, v);
 
 	bool has_uv_or_vu = false;
+	for(auto& vertex : m_vertices)
+		detail::out_edges_unindex(vertex.out_edges);
 	const auto rename = [v](vertex_index_t i) noexcept -> vertex_index_t { return i - (i > v); };
 
 	// this block can be implemented more efficiently for different out_edge_container data structures
@@ -478,11 +719,17 @@ bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	// relabel all u -> j edges
 	for(auto& out_edge : V[u].out_edges)
 		out_edge.to = rename(out_edge.to);
+	// merging u and v may have moved an edge out of order
+	if constexpr(is_sorted_container<out_edge_list_t>)
+		sort_edges();
+	for(auto& vertex : m_vertices)
+		detail::out_edges_reindex(vertex.out_edges);
+	in_edges_rebuild();
 
 	return has_uv_or_vu;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-quiver::vertex_index_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::cleave(vertex_index_t v)
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+quiver::vertex_index_t quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::cleave(vertex_index_t v)
 {
 	assert(v < V.size());
 
@@ -498,8 +745,8 @@ quiver::vertex_index_t quiver::adjacency_list<dir, edge_properties_t, vertex_pro
 	return new_v;
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::swap(adjacency_list& rhs) noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::swap(adjacency_list& rhs) noexcept
 {
 	using std::swap;
 	swap(m_vertices, rhs.m_vertices);
@@ -507,19 +754,19 @@ void quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edg
 	swap(m_e, rhs.m_e);
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::is_weighted() noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::is_weighted() noexcept
 {
 	return is_weighted_v<adjacency_list>;
 }
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>::is_simple() noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+constexpr bool quiver::adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container>::is_simple() noexcept
 {
 	return !is_weighted() && directivity == undirected;
 }
 
-template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container>
-void quiver::swap(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& lhs, adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& rhs) noexcept
+template<quiver::directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+void quiver::swap(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container> const& lhs, adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container> const& rhs) noexcept
 {
 	lhs.swap(rhs);
 }
@@ -0,0 +1,212 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_ARENA_HPP_INCLUDED
+#define QUIVER_ARENA_HPP_INCLUDED
+
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <mutex>
+#include <list>
+#include <cstddef>
+
+namespace quiver
+{
+	// A monotonic buffer from which whole graphs can be allocated: an allocation takes a pointer bump and
+	// deallocation does nothing, so the many small out_edges containers don't fragment the heap. All the memory
+	// is returned at once by release or the destructor, which must not happen before the containers which use it
+	// have been destroyed. Destroying a graph still runs the destructor of every container, which takes O(V)
+	// time; only the deallocations are free. Allocations are serialized, so that parallel builders such as
+	// build_from_edges may share one arena.
+	class arena : public std::pmr::memory_resource
+	{
+		std::pmr::monotonic_buffer_resource m_buffer;
+		std::mutex m_mutex;
+
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			return m_buffer.allocate(bytes, alignment);
+		}
+		void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+		{
+			(void)pointer; // -Wunused-parameter
+			(void)bytes; // -Wunused-parameter
+			(void)alignment; // -Wunused-parameter
+		}
+		bool do_is_equal(std::pmr::memory_resource const& rhs) const noexcept override
+		{
+			return this == &rhs;
+		}
+
+	public:
+		arena() = default;
+		// the size of the first block taken from upstream; later blocks grow geometrically
+		explicit arena(std::size_t initial_size, std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+		: m_buffer(initial_size, upstream)
+		{
+		}
+		arena(arena const&) = delete;
+		arena& operator=(arena const&) = delete;
+
+		// returns all the memory to upstream
+		void release()
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_buffer.release();
+		}
+	};
+
+	// While an arena_scope is alive, the arena_allocators which are default-constructed on its thread allocate
+	// from its resource, e.g. all the containers of a graph which is constructed, copied or grown within the
+	// scope. A container keeps its resource after the scope has ended. Scopes nest; outside of any scope, the
+	// resource is std::pmr::new_delete_resource().
+	class arena_scope
+	{
+		std::pmr::memory_resource* m_previous;
+
+		static std::pmr::memory_resource*& current_resource() noexcept
+		{
+			thread_local std::pmr::memory_resource* resource = std::pmr::new_delete_resource();
+			return resource;
+		}
+
+	public:
+		explicit arena_scope(std::pmr::memory_resource& resource) noexcept
+		: m_previous(std::exchange(current_resource(), &resource))
+		{
+		}
+		arena_scope(arena_scope const&) = delete;
+		arena_scope& operator=(arena_scope const&) = delete;
+		~arena_scope()
+		{
+			current_resource() = m_previous;
+		}
+
+		static std::pmr::memory_resource* current() noexcept
+		{
+			return current_resource();
+		}
+	};
+
+	// An allocator which draws from a std::pmr::memory_resource, by default that of the innermost arena_scope.
+	// Unlike std::pmr::polymorphic_allocator, it follows its container on move assignment and swap, which keeps
+	// these noexcept as adjacency_list requires of its containers (see is_sane_container), and a copied container
+	// takes the resource of the scope it is copied in.
+	template<typename T>
+	class arena_allocator
+	{
+		template<typename U>
+		friend class arena_allocator;
+
+		std::pmr::memory_resource* m_resource;
+
+	public:
+		using value_type = T;
+		using propagate_on_container_copy_assignment = std::false_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+		using is_always_equal = std::false_type;
+
+		arena_allocator() noexcept
+		: m_resource(arena_scope::current())
+		{
+		}
+		explicit arena_allocator(std::pmr::memory_resource* resource) noexcept
+		: m_resource(resource)
+		{
+		}
+		template<typename U>
+		arena_allocator(arena_allocator<U> const& rhs) noexcept
+		: m_resource(rhs.m_resource)
+		{
+		}
+
+		[[nodiscard]] T* allocate(std::size_t count)
+		{
+			return static_cast<T*>(m_resource->allocate(count * sizeof(T), alignof(T)));
+		}
+		void deallocate(T* pointer, std::size_t count) noexcept
+		{
+			m_resource->deallocate(pointer, count * sizeof(T), alignof(T));
+		}
+
+		arena_allocator select_on_container_copy_construction() const noexcept
+		{
+			return arena_allocator();
+		}
+		std::pmr::memory_resource* resource() const noexcept
+		{
+			return m_resource;
+		}
+
+		template<typename U>
+		friend bool operator==(arena_allocator const& lhs, arena_allocator<U> const& rhs) noexcept
+		{
+			return lhs.m_resource == rhs.m_resource || lhs.m_resource->is_equal(*rhs.m_resource);
+		}
+	};
+
+	// An allocator without state for vertex_container. adjacency_list takes the offsetof of V and E, assuming
+	// its vertex container to be standard layout as std::vector usually is; a stateless allocator keeps that
+	// assumption intact, unlike a stateful one, though debug builds of the standard library may still break it.
+	// Every allocation draws from the resource of the innermost arena_scope and keeps a pointer to it in a header
+	// in front of the elements, where deallocate finds it. Hence a vertex container takes the resource of the
+	// scope it allocates in, also when it grows after a move.
+	template<typename T>
+	class arena_vertex_allocator
+	{
+		static constexpr std::size_t alignment = alignof(T) > alignof(std::pmr::memory_resource*) ? alignof(T) : alignof(std::pmr::memory_resource*);
+		// the header is a multiple of alignment, so that the elements behind it stay aligned
+		static constexpr std::size_t header_size = (sizeof(std::pmr::memory_resource*) + alignment - 1) / alignment * alignment;
+
+	public:
+		using value_type = T;
+		using is_always_equal = std::true_type;
+
+		arena_vertex_allocator() noexcept = default;
+		template<typename U>
+		arena_vertex_allocator(arena_vertex_allocator<U> const&) noexcept
+		{
+		}
+
+		[[nodiscard]] T* allocate(std::size_t count)
+		{
+			std::pmr::memory_resource* resource = arena_scope::current();
+			char* block = static_cast<char*>(resource->allocate(header_size + count * sizeof(T), alignment));
+			::new(block + header_size - sizeof(std::pmr::memory_resource*)) std::pmr::memory_resource*(resource);
+			return reinterpret_cast<T*>(block + header_size);
+		}
+		void deallocate(T* pointer, std::size_t count) noexcept
+		{
+			char* block = reinterpret_cast<char*>(pointer) - header_size;
+			std::pmr::memory_resource* resource = *std::launder(reinterpret_cast<std::pmr::memory_resource**>(block + header_size - sizeof(std::pmr::memory_resource*)));
+			resource->deallocate(block, header_size + count * sizeof(T), alignment);
+		}
+
+		template<typename U>
+		friend bool operator==(arena_vertex_allocator const&, arena_vertex_allocator<U> const&) noexcept
+		{
+			return true;
+		}
+	};
+
+	// out_edge_container and in_edge_container templates which allocate through arena_allocator; container_traits
+	// covers them as it does std::vector and std::list with any allocator. They are not meant as vertex_container,
+	// since their stateful allocator breaks the standard layout adjacency_list assumes; use arena_vertex_vector.
+	template<typename T>
+	using arena_vector = std::vector<T, arena_allocator<T>>;
+	template<typename T>
+	using arena_list = std::list<T, arena_allocator<T>>;
+	template<typename T>
+	using arena_vertex_vector = std::vector<T, arena_vertex_allocator<T>>;
+}
+
+#endif // !QUIVER_ARENA_HPP_INCLUDED
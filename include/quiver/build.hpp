@@ -0,0 +1,161 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_BUILD_HPP_INCLUDED
+#define QUIVER_BUILD_HPP_INCLUDED
+
+#include <quiver/adjacency_list.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/typedefs.hpp>
+#include <algorithm>
+#include <utility>
+#include <ranges>
+#include <vector>
+#include <atomic>
+#include <limits>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+
+namespace quiver
+{
+	namespace detail
+	{
+		struct edge_list_builder
+		{
+			// the number of edges, respectively vertices, a worker takes at once
+			inline static constexpr std::size_t edge_grain = std::size_t(1) << 14;
+			inline static constexpr std::size_t vertex_grain = std::size_t(1) << 10;
+
+			// groups the positions of the out-edges by their source in staging, offsets being the bounds of the
+			// groups, and emplaces the first of every set of duplicates into the out_edges containers
+			template<typename position_t, typename graph_t>
+			static void scatter(graph_t& graph, std::ranges::random_access_range auto const& edges, std::vector<std::size_t> const& offsets, thread_pool& pool)
+			{
+				using index_t = typename graph_t::vertex_index_type;
+
+				const std::size_t n = graph.m_vertices.size();
+				const std::size_t m = std::ranges::size(edges);
+				const auto first = std::ranges::begin(edges);
+
+				std::vector<position_t> staging(offsets[n]);
+				std::vector<std::size_t> cursors(offsets.begin(), offsets.end() - 1);
+				pool.parallel_for(m, edge_grain, [&](std::size_t worker, std::size_t begin, std::size_t end) {
+					(void)worker; // -Wunused-parameter
+					for(std::size_t i = begin; i < end; ++i) {
+						auto const& edge = first[i];
+						staging[std::atomic_ref<std::size_t>(cursors[edge.from]).fetch_add(1, std::memory_order_relaxed)] = static_cast<position_t>(i);
+						if constexpr(graph_t::directivity == undirected)
+							staging[std::atomic_ref<std::size_t>(cursors[edge.to]).fetch_add(1, std::memory_order_relaxed)] = static_cast<position_t>(i);
+					}
+				});
+				cursors = std::vector<std::size_t>();
+
+				// sorting a group by target and position puts the duplicates next to each other, the first one in
+				// edges in front, which is the one E.emplace would have kept
+				std::vector<std::size_t> kept(pool.size(), 0);
+				pool.parallel_for(n, vertex_grain, [&](std::size_t worker, std::size_t begin, std::size_t end) {
+					std::size_t count = 0;
+					for(std::size_t v = begin; v < end; ++v) {
+						// an undirected edge is staged with both of its ends; no loops, so the other one is the target
+						const auto target = [&](position_t position) -> index_t {
+							auto const& edge = first[position];
+							if constexpr(graph_t::directivity == undirected)
+								if(edge.to == v)
+									return static_cast<index_t>(edge.from);
+							return static_cast<index_t>(edge.to);
+						};
+						const auto group_begin = staging.begin() + offsets[v];
+						const auto group_end = staging.begin() + offsets[v + 1];
+						std::sort(group_begin, group_end, [&](position_t lhs, position_t rhs) {
+							const index_t lhs_target = target(lhs), rhs_target = target(rhs);
+							return lhs_target < rhs_target || (lhs_target == rhs_target && lhs < rhs);
+						});
+						const auto is_first = [&](auto iter) {
+							return iter == group_begin || target(iter[-1]) != target(*iter);
+						};
+
+						auto& out_edges = graph.m_vertices[v].out_edges;
+						out_edges.clear();
+						if constexpr(requires { out_edges.reserve(std::size_t{}); }) {
+							std::size_t distinct = 0;
+							for(auto iter = group_begin; iter != group_end; ++iter)
+								distinct += is_first(iter);
+							out_edges.reserve(distinct);
+						}
+						for(auto iter = group_begin; iter != group_end; ++iter)
+							if(is_first(iter)) {
+								out_edges.emplace_back(target(*iter), first[*iter].properties());
+								++count;
+							}
+					}
+					kept[worker] += count;
+				});
+
+				graph.m_e = 0;
+				for(std::size_t count : kept)
+					graph.m_e += count;
+			}
+
+			// replaces the edges of graph by those of edges
+			template<typename graph_t>
+			static void assign(graph_t& graph, std::ranges::random_access_range auto const& edges, thread_pool& pool)
+			{
+				const std::size_t n = graph.m_vertices.size();
+				const std::size_t m = std::ranges::size(edges);
+				const auto first = std::ranges::begin(edges);
+
+				// vertex -> the number of its out-edges, then the position of the first of them in staging
+				std::vector<std::size_t> offsets(n + 1, 0);
+				pool.parallel_for(m, edge_grain, [&](std::size_t worker, std::size_t begin, std::size_t end) {
+					(void)worker; // -Wunused-parameter
+					for(std::size_t i = begin; i < end; ++i) {
+						auto const& edge = first[i];
+						assert(edge.from < n);
+						assert(edge.to < n);
+						assert(edge.from != edge.to); // no loops
+						std::atomic_ref<std::size_t>(offsets[edge.from + 1]).fetch_add(1, std::memory_order_relaxed);
+						if constexpr(graph_t::directivity == undirected)
+							std::atomic_ref<std::size_t>(offsets[edge.to + 1]).fetch_add(1, std::memory_order_relaxed);
+					}
+				});
+				for(std::size_t v = 0; v < n; ++v)
+					offsets[v + 1] += offsets[v];
+
+				// the position in edges of every out-edge, grouped by the source by a counting sort; the target is
+				// looked up in edges, which keeps staging at 4 bytes per out-edge as long as the positions fit
+				if(m <= std::numeric_limits<std::uint32_t>::max())
+					scatter<std::uint32_t>(graph, edges, offsets, pool);
+				else
+					scatter<std::size_t>(graph, edges, offsets, pool);
+
+				graph.in_edges_rebuild();
+			}
+		};
+	}
+
+	// Builds a graph_t with the given number of vertices and the edges of edges, a random access range of edge_t,
+	// in O(V + E log(max degree)) instead of one E.emplace with its duplicate check per edge. The out-degrees are
+	// counted first, so that the out-edges are scattered by a counting sort into one array and every out_edges
+	// container is reserved exactly once. Duplicates are dropped, keeping the first one like E.emplace, and the
+	// out-edges of every vertex end up sorted by their target. Every pass runs on the workers of pool.
+	template<typename graph_t>
+	[[nodiscard]] graph_t build_from_edges(std::size_t vertices, std::ranges::random_access_range auto const& edges, thread_pool& pool)
+	{
+		graph_t graph(vertices);
+		detail::edge_list_builder::assign(graph, edges, pool);
+		return graph;
+	}
+	template<typename graph_t>
+	[[nodiscard]] graph_t build_from_edges(std::size_t vertices, std::ranges::random_access_range auto const& edges)
+	{
+		thread_pool pool;
+		return build_from_edges<graph_t>(vertices, edges, pool);
+	}
+}
+
+#endif // !QUIVER_BUILD_HPP_INCLUDED
@@ -22,6 +22,23 @@ namespace quiver
 	template<typename T>
 	using list = std::list<T>;
 
+	// A vector which adjacency_list keeps sorted by the target of its out-edges, such that an edge is found by a
+	// binary search and the neighborhoods of two vertices can be merged. Insertions shift the greater elements.
+	// See also hash_indexed_vector.
+	template<typename T>
+	struct sorted_vector : public std::vector<T>
+	{
+		using std::vector<T>::vector;
+	};
+
+	// how a container of out-edges finds the edge to a vertex, see container_traits::lookup
+	enum class lookup_t
+	{
+		linear,			// scans all the elements
+		binary_search,	// keeps the elements sorted by their target
+		hash			// finds the element by a hash index through a member find
+	};
+
 	template<typename T>
 	inline constexpr bool is_sane_container =
 		std::is_nothrow_constructible_v<T> &&
@@ -39,6 +56,7 @@ namespace quiver
 	{
 		static constexpr bool is_specialized = true;
 		static constexpr bool is_ordered = true;
+		static constexpr lookup_t lookup = lookup_t::linear;
 
 		using container_type = std::vector<T, allocator_t>;
 		using value_type = T;
@@ -59,6 +77,7 @@ namespace quiver
 	{
 		static constexpr bool is_specialized = true;
 		static constexpr bool is_ordered = true;
+		static constexpr lookup_t lookup = lookup_t::linear;
 
 		using container_type = std::list<T, allocator_t>;
 		using value_type = T;
@@ -71,6 +90,26 @@ namespace quiver
 			container.sort(comparator);
 		}
 	};
+	template<typename T>
+	struct container_traits<sorted_vector<T>> : public container_traits<std::vector<T>>
+	{
+		static constexpr lookup_t lookup = lookup_t::binary_search;
+
+		using container_type = sorted_vector<T>;
+		template<typename U>
+		using rebind = sorted_vector<U>;
+	};
+
+	template<typename T>
+	inline constexpr lookup_t container_lookup_v = [](){
+		if constexpr(container_traits<T>::is_specialized)
+			return container_traits<T>::lookup;
+		else
+			return lookup_t::linear;
+	}();
+	// whether the elements of the container are kept sorted, see sorted_vector
+	template<typename T>
+	inline constexpr bool is_sorted_container = container_lookup_v<T> == lookup_t::binary_search;
 }
 
 #endif // !QUIVER_CONTAINER_TRAITS_HPP_INCLUDED
@@ -0,0 +1,460 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_CONTRACTION_HIERARCHY_HPP_INCLUDED
+#define QUIVER_CONTRACTION_HIERARCHY_HPP_INCLUDED
+
+#include <quiver/adjacency_list.hpp>
+#include <quiver/properties.hpp>
+#include <quiver/exception.hpp>
+#include <quiver/heaps/binary_heap.hpp>
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/search/workspace.hpp>
+#include <quiver/search/bidirectional.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <istream>
+#include <ostream>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+
+namespace quiver
+{
+	// the vertex a shortcut of a contraction_hierarchy bypasses
+	template<typename T>
+	struct shortcut_via
+	{
+		T via;
+
+		constexpr shortcut_via(shortcut_via& rhs)
+		: via(rhs.via)
+		{
+		}
+		constexpr shortcut_via(shortcut_via const& rhs)
+		: via(rhs.via)
+		{
+		}
+		constexpr shortcut_via(shortcut_via&& rhs)
+		: via(std::move(rhs.via))
+		{
+		}
+		constexpr shortcut_via(shortcut_via const&& rhs)
+		: via(std::move(rhs.via))
+		{
+		}
+
+		template<typename... args_t>
+		constexpr shortcut_via(args_t&&... args) noexcept(std::is_nothrow_constructible_v<T, args_t...>)
+		: via(std::forward<args_t>(args)...)
+		{
+		}
+
+		constexpr shortcut_via& operator=(shortcut_via const& rhs) = default;
+		constexpr shortcut_via& operator=(shortcut_via&& rhs) = default;
+	};
+
+	// Ranks the vertices of a graph by contracting them one after another, each time the one whose removal adds
+	// the fewest shortcuts, and keeps every edge and shortcut from a vertex to one of higher rank. A shortcut
+	// u -> w via v replaces the path u -> v -> w whenever a bounded local search finds no path from u to w of at
+	// most the same length which avoids v. Every shortest path then climbs in rank up to its highest vertex and
+	// descends afterwards, so shortest_path_to only searches upward from both ends, which settles few vertices.
+	// The hierarchy is static: it has to be rebuilt when the graph changes. write and read serialize it.
+	template<typename scalar_t, typename index_t = vertex_index_t>
+	class contraction_hierarchy
+	{
+	public:
+		using scalar_type = scalar_t;
+		using vertex_index_type = index_t;
+		using graph_type = adjacency_list<directed, cmb<wt<scalar_t>, shortcut_via<index_t>>, void, vector, vector, index_t>;
+		using workspace_type = search_workspace<scalar_t, index_t>;
+
+		// the via of the edges which are no shortcuts
+		static constexpr index_t no_via = ~index_t{};
+		// the number of vertices a witness search may settle before it gives up and a shortcut is added
+		static constexpr std::size_t witness_settle_limit = 256;
+
+	private:
+		std::vector<index_t> m_rank;
+		// the edges to vertices of higher rank
+		graph_type m_upward;
+		// the edges from vertices of higher rank, reversed
+		graph_type m_downward;
+
+		contraction_hierarchy()
+		: m_upward(0), m_downward(0)
+		{
+		}
+
+		struct overlay_edge_t
+		{
+			index_t to;
+			scalar_t weight;
+			index_t via;
+		};
+		// the graph of the vertices not yet contracted, together with the shortcuts added so far
+		class overlay_t
+		{
+		public:
+			std::vector<std::vector<overlay_edge_t>> out, in;
+
+			explicit overlay_t(std::size_t n)
+			: out(n), in(n)
+			{
+			}
+
+			// adds from -> to or lowers its weight
+			void relax(index_t from, index_t to, scalar_t weight, index_t via)
+			{
+				const auto find = [](std::vector<overlay_edge_t>& edges, index_t to) {
+					return std::find_if(edges.begin(), edges.end(), [to](overlay_edge_t const& edge) { return edge.to == to; });
+				};
+				const auto forward = find(out[from], to);
+				if(forward == out[from].end()) {
+					out[from].push_back({ to, weight, via });
+					in[to].push_back({ from, weight, via });
+				} else if(weight < forward->weight) {
+					*forward = { to, weight, via };
+					*find(in[to], from) = { from, weight, via };
+				}
+			}
+		};
+
+		// A local dijkstra from start on overlay which avoids avoided and gives up beyond limit. Returns the number
+		// of shortcuts the contraction of avoided requires for the in-edge from start; adds them unless simulate.
+		std::size_t contract_in_edge(overlay_t& overlay, workspace_type& witness, overlay_edge_t const& in_edge, index_t avoided, bool simulate) const
+		{
+			using queue_entry_t = typename workspace_type::queue_entry_type;
+
+			const index_t start = in_edge.to;
+			scalar_t limit = scalar_t(0);
+			for(overlay_edge_t const& out_edge : overlay.out[avoided])
+				if(out_edge.to != start)
+					limit = std::max(limit, in_edge.weight + out_edge.weight);
+
+			witness.begin(m_rank.size());
+			witness.discover(start, scalar_t(0), start);
+			witness.heap().push(queue_entry_t{ start, scalar_t(0) });
+			for(std::size_t settled = 0; !witness.heap().empty() && settled < witness_settle_limit;) {
+				const queue_entry_t top = witness.heap().extract_top();
+				if(witness.visited(top.index))
+					continue;
+				if(limit < top.distance)
+					break;
+				witness.visit(top.index);
+				++settled;
+				for(overlay_edge_t const& edge : overlay.out[top.index])
+					if(edge.to != avoided && !witness.visited(edge.to) && witness.relax(edge.to, top.distance + edge.weight, top.index))
+						witness.heap().push(queue_entry_t{ edge.to, top.distance + edge.weight });
+			}
+
+			std::size_t shortcuts = 0;
+			for(overlay_edge_t const& out_edge : overlay.out[avoided]) {
+				if(out_edge.to == start)
+					continue;
+				const scalar_t distance = in_edge.weight + out_edge.weight;
+				if(witness.discovered(out_edge.to) && !(distance < witness.distance(out_edge.to)))
+					continue;
+				++shortcuts;
+				if(!simulate)
+					overlay.relax(start, out_edge.to, distance, avoided);
+			}
+			return shortcuts;
+		}
+		std::size_t contract(overlay_t& overlay, workspace_type& witness, index_t vertex, bool simulate) const
+		{
+			std::size_t shortcuts = 0;
+			// relax doesn't touch the edges of vertex, so the reference remains valid
+			for(overlay_edge_t const& in_edge : overlay.in[vertex])
+				shortcuts += contract_in_edge(overlay, witness, in_edge, vertex, simulate);
+			return shortcuts;
+		}
+
+		// edge_difference plus the number of contracted neighbors, which spreads the contractions over the graph
+		std::ptrdiff_t priority(overlay_t& overlay, workspace_type& witness, index_t vertex, std::vector<std::size_t> const& contracted_neighbors) const
+		{
+			const std::size_t removed = overlay.in[vertex].size() + overlay.out[vertex].size();
+			return static_cast<std::ptrdiff_t>(contract(overlay, witness, vertex, true)) - static_cast<std::ptrdiff_t>(removed) + static_cast<std::ptrdiff_t>(contracted_neighbors[vertex]);
+		}
+
+		// the edge from -> to of the hierarchy
+		auto const& hierarchy_edge(index_t from, index_t to) const
+		{
+			if(m_rank[from] < m_rank[to]) {
+				auto const& out_edges = m_upward.V[from].out_edges;
+				const auto iter = std::find_if(out_edges.begin(), out_edges.end(), [to](auto const& edge) { return edge.to == to; });
+				assert(iter != out_edges.end());
+				return *iter;
+			} else {
+				auto const& out_edges = m_downward.V[to].out_edges;
+				const auto iter = std::find_if(out_edges.begin(), out_edges.end(), [from](auto const& edge) { return edge.to == from; });
+				assert(iter != out_edges.end());
+				return *iter;
+			}
+		}
+		// appends the vertices after from up to to on the path the edge from -> to of the hierarchy stands for
+		void unpack(index_t from, index_t to, std::vector<vertex_index_t>& vertices) const
+		{
+			std::vector<std::pair<index_t, index_t>> stack{ { from, to } };
+			while(!stack.empty()) {
+				const auto [first, second] = stack.back();
+				stack.pop_back();
+				const index_t via = hierarchy_edge(first, second).via;
+				if(via == no_via) {
+					vertices.push_back(second);
+				} else {
+					stack.emplace_back(via, second);
+					stack.emplace_back(first, via);
+				}
+			}
+		}
+
+	public:
+		// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t) and return no negative weights.
+		template<typename graph_t, typename weight_invokable_t>
+		contraction_hierarchy(graph_t const& graph, weight_invokable_t weight_invokable)
+		: m_rank(graph.V.size()), m_upward(graph.V.size()), m_downward(graph.V.size())
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+			using priority_entry_t = std::pair<std::ptrdiff_t, index_t>;
+
+			const std::size_t n = graph.V.size();
+			overlay_t overlay(n);
+			for(vertex_index_t from = 0; from < n; ++from)
+				for(out_edge_t const& edge : graph.V[from].out_edges) {
+					const scalar_t weight = scalar_t(weight_invokable(from, edge));
+					assert(!(weight < scalar_t(0)));
+					overlay.relax(static_cast<index_t>(from), static_cast<index_t>(edge.to), weight, no_via);
+				}
+
+			workspace_type witness(n);
+			std::vector<std::size_t> contracted_neighbors(n, 0);
+			binary_heap<priority_entry_t> queue;
+			for(vertex_index_t vertex = 0; vertex < n; ++vertex)
+				queue.push(priority(overlay, witness, static_cast<index_t>(vertex), contracted_neighbors), static_cast<index_t>(vertex));
+
+			for(index_t rank = 0; !queue.empty();) {
+				const index_t vertex = queue.extract_top().second;
+				// the priority may have risen since the neighbors of vertex have been contracted
+				const std::ptrdiff_t current = priority(overlay, witness, vertex, contracted_neighbors);
+				if(!queue.empty() && queue.top().first < current) {
+					queue.push(current, vertex);
+					continue;
+				}
+
+				contract(overlay, witness, vertex, false);
+				m_rank[vertex] = rank++;
+				for(overlay_edge_t const& edge : overlay.out[vertex]) {
+					m_upward.E.emplace(vertex, edge.to, edge.weight, edge.via);
+					std::erase_if(overlay.in[edge.to], [vertex](overlay_edge_t const& in_edge) { return in_edge.to == vertex; });
+					++contracted_neighbors[edge.to];
+				}
+				for(overlay_edge_t const& edge : overlay.in[vertex]) {
+					m_downward.E.emplace(vertex, edge.to, edge.weight, edge.via);
+					std::erase_if(overlay.out[edge.to], [vertex](overlay_edge_t const& out_edge) { return out_edge.to == vertex; });
+					++contracted_neighbors[edge.to];
+				}
+				overlay.out[vertex] = {};
+				overlay.in[vertex] = {};
+			}
+		}
+		template<typename graph_t>
+		explicit contraction_hierarchy(graph_t const& graph)
+		: contraction_hierarchy(graph, dijkstra_default_weight_invokable<graph_t>())
+		{
+		}
+
+		// the number of vertices
+		std::size_t size() const noexcept
+		{
+			return m_rank.size();
+		}
+		// the position of vertex in the order of contraction
+		index_t rank(vertex_index_t vertex) const noexcept
+		{
+			assert(vertex < size());
+			return m_rank[vertex];
+		}
+		graph_type const& upward() const noexcept
+		{
+			return m_upward;
+		}
+		graph_type const& downward() const noexcept
+		{
+			return m_downward;
+		}
+
+		// Searches upward from start and upward along the reversed edges from target, each side until its queue
+		// holds no vertex closer than the shortest path found so far, and unpacks the shortcuts of that path.
+		// Reusing the workspaces avoids all allocations once they have grown to the size of the hierarchy.
+		[[nodiscard]] search_path_t<scalar_t> shortest_path_to(vertex_index_t start, vertex_index_t target, workspace_type& forward, workspace_type& backward) const
+		{
+			using queue_entry_t = typename workspace_type::queue_entry_type;
+
+			assert(start < size());
+			assert(target < size());
+			forward.begin(size());
+			backward.begin(size());
+			forward.discover(start, scalar_t(0), static_cast<index_t>(start));
+			forward.heap().push(queue_entry_t{ static_cast<index_t>(start), scalar_t(0) });
+			backward.discover(target, scalar_t(0), static_cast<index_t>(target));
+			backward.heap().push(queue_entry_t{ static_cast<index_t>(target), scalar_t(0) });
+
+			scalar_t best = inf<scalar_t>;
+			index_t meeting = 0;
+			for(;;) {
+				detail::skip_visited(forward);
+				detail::skip_visited(backward);
+				const bool forward_done = forward.heap().empty() || !(forward.heap().top().distance < best);
+				const bool backward_done = backward.heap().empty() || !(backward.heap().top().distance < best);
+				if(forward_done && backward_done)
+					break;
+
+				const bool forward_turn = backward_done || (!forward_done && !(backward.heap().top().distance < forward.heap().top().distance));
+				workspace_type& side = forward_turn ? forward : backward;
+				workspace_type& other = forward_turn ? backward : forward;
+				graph_type const& graph = forward_turn ? m_upward : m_downward;
+
+				const queue_entry_t top = side.heap().extract_top();
+				side.visit(top.index);
+				if(other.discovered(top.index) && top.distance + other.distance(top.index) < best) {
+					best = top.distance + other.distance(top.index);
+					meeting = top.index;
+				}
+				for(auto const& edge : graph.V[top.index].out_edges)
+					if(!side.visited(edge.to) && side.relax(edge.to, top.distance + edge.weight, top.index))
+						side.heap().push(queue_entry_t{ edge.to, top.distance + edge.weight });
+			}
+
+			search_path_t<scalar_t> result;
+			if(best == inf<scalar_t>)
+				return result;
+			result.distance = best;
+			std::vector<index_t> upward_chain;
+			for(index_t index = meeting;; index = forward.predecessor(index)) {
+				upward_chain.push_back(index);
+				if(forward.predecessor(index) == index)
+					break;
+			}
+			result.vertices.push_back(upward_chain.back());
+			for(std::size_t i = upward_chain.size() - 1; i > 0; --i)
+				unpack(upward_chain[i], upward_chain[i - 1], result.vertices);
+			for(index_t index = meeting; backward.predecessor(index) != index; index = backward.predecessor(index))
+				unpack(index, backward.predecessor(index), result.vertices);
+			return result;
+		}
+		[[nodiscard]] search_path_t<scalar_t> shortest_path_to(vertex_index_t start, vertex_index_t target) const
+		{
+			workspace_type forward(size()), backward(size());
+			return shortest_path_to(start, target, forward, backward);
+		}
+
+		// The binary format is native to the machine: a header, the ranks and the edges of both directions.
+		void write(std::ostream& stream) const
+		{
+			static_assert(std::is_trivially_copyable_v<scalar_t>);
+			const auto put = [&stream](auto const& value) {
+				stream.write(reinterpret_cast<char const*>(&value), sizeof(value));
+			};
+			put(format_tag);
+			put(std::uint32_t(sizeof(scalar_t)));
+			put(std::uint32_t(sizeof(index_t)));
+			put(std::uint64_t(size()));
+			for(index_t rank : m_rank)
+				put(rank);
+			for(graph_type const* graph : { &m_upward, &m_downward })
+				for(vertex_index_t from = 0; from < size(); ++from) {
+					put(std::uint64_t(graph->V[from].out_edges.size()));
+					for(auto const& edge : graph->V[from].out_edges) {
+						put(edge.to);
+						put(edge.weight);
+						put(edge.via);
+					}
+				}
+		}
+		// throws malformed_input if stream doesn't hold a hierarchy of this type as written by write
+		[[nodiscard]] static contraction_hierarchy read(std::istream& stream)
+		{
+			const auto get = [&stream](auto& value) {
+				if(!stream.read(reinterpret_cast<char*>(&value), sizeof(value)))
+					throw malformed_input("contraction_hierarchy: unexpected end of input");
+			};
+			std::uint64_t tag, n;
+			std::uint32_t scalar_size, index_size;
+			get(tag);
+			get(scalar_size);
+			get(index_size);
+			if(tag != format_tag || scalar_size != sizeof(scalar_t) || index_size != sizeof(index_t))
+				throw malformed_input("contraction_hierarchy: not a hierarchy of this type");
+			get(n);
+			// every vertex must differ from no_via
+			if(n > no_via)
+				throw malformed_input("contraction_hierarchy: too many vertices");
+
+			contraction_hierarchy result;
+			// n isn't trusted before the ranks have been read, so the ranks grow instead of being allocated upfront
+			for(std::uint64_t i = 0; i < n; ++i) {
+				index_t rank;
+				get(rank);
+				result.m_rank.push_back(rank);
+			}
+			{
+				std::vector<bool> ranked(n, false);
+				for(index_t rank : result.m_rank) {
+					if(rank >= n || ranked[rank])
+						throw malformed_input("contraction_hierarchy: ranks are no permutation");
+					ranked[rank] = true;
+				}
+			}
+			auto const& rank = result.m_rank;
+			for(graph_type* graph : { &result.m_upward, &result.m_downward }) {
+				graph_type(n).swap(*graph);
+				for(vertex_index_t from = 0; from < n; ++from) {
+					std::uint64_t edges;
+					get(edges);
+					for(; edges > 0; --edges) {
+						index_t to, via;
+						scalar_t weight;
+						get(to);
+						get(weight);
+						get(via);
+						if(to >= n || !(rank[from] < rank[to]) || (via != no_via && via >= n) || !graph->E.emplace(from, to, weight, via))
+							throw malformed_input("contraction_hierarchy: invalid edge");
+					}
+				}
+			}
+			// a shortcut has to bypass a vertex of lower rank than both its ends through two edges of the hierarchy,
+			// otherwise unpack wouldn't terminate or hierarchy_edge wouldn't find them
+			const auto has_edge = [&result](index_t from, index_t to) {
+				return result.m_rank[from] < result.m_rank[to] ? result.m_upward.V[from].has_edge_to(to) : result.m_downward.V[to].has_edge_to(from);
+			};
+			for(vertex_index_t from = 0; from < n; ++from) {
+				for(auto const& edge : result.m_upward.V[from].out_edges)
+					if(edge.via != no_via && !(rank[edge.via] < rank[from] && has_edge(index_t(from), edge.via) && has_edge(edge.via, edge.to)))
+						throw malformed_input("contraction_hierarchy: invalid shortcut");
+				// the edges of m_downward are reversed
+				for(auto const& edge : result.m_downward.V[from].out_edges)
+					if(edge.via != no_via && !(rank[edge.via] < rank[from] && has_edge(edge.to, edge.via) && has_edge(edge.via, index_t(from))))
+						throw malformed_input("contraction_hierarchy: invalid shortcut");
+			}
+			return result;
+		}
+
+	private:
+		static constexpr std::uint64_t format_tag = 0x3148435276697551; // "QuivRCH1"
+	};
+
+	template<typename graph_t, typename weight_invokable_t>
+	contraction_hierarchy(graph_t const&, weight_invokable_t) -> contraction_hierarchy<std::invoke_result_t<weight_invokable_t, vertex_index_t, typename graph_t::out_edge_t const>, typename graph_t::vertex_index_type>;
+	template<typename graph_t>
+	contraction_hierarchy(graph_t const&) -> contraction_hierarchy<std::remove_cvref_t<weight_type<graph_t>>, typename graph_t::vertex_index_type>;
+}
+
+#endif // !QUIVER_CONTRACTION_HIERARCHY_HPP_INCLUDED
@@ -0,0 +1,331 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_CSR_GRAPH_HPP_INCLUDED
+#define QUIVER_CSR_GRAPH_HPP_INCLUDED
+
+#include <quiver/typedefs.hpp>
+#include <quiver/util.hpp>
+#include <quiver/properties.hpp>
+#include <quiver/adjacency_list.hpp>
+#include <type_traits>
+#include <utility>
+#include <iterator>
+#include <cstddef>
+#include <vector>
+#include <cassert>
+
+namespace quiver
+{
+	// A non-owning view of the out-edges of one vertex of a csr_graph. Constness propagates to the edges.
+	template<typename out_edge_t>
+	class out_edge_span
+	{
+		out_edge_t* m_first = nullptr;
+		out_edge_t* m_last = nullptr;
+
+	public:
+		using value_type = out_edge_t;
+		using iterator = out_edge_t*;
+		using const_iterator = out_edge_t const*;
+		using reverse_iterator = std::reverse_iterator<iterator>;
+		using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+		constexpr out_edge_span() noexcept = default;
+		constexpr out_edge_span(out_edge_t* first, out_edge_t* last) noexcept
+		: m_first(first), m_last(last)
+		{
+		}
+
+		constexpr std::size_t size()                          const noexcept { return m_last - m_first; }
+		constexpr bool empty()                                const noexcept { return m_first == m_last; }
+
+		constexpr iterator begin()                                  noexcept { return m_first; }
+		constexpr const_iterator begin()                      const noexcept { return m_first; }
+		constexpr const_iterator cbegin()                     const noexcept { return m_first; }
+		constexpr iterator end()                                    noexcept { return m_last; }
+		constexpr const_iterator end()                        const noexcept { return m_last; }
+		constexpr const_iterator cend()                       const noexcept { return m_last; }
+
+		constexpr reverse_iterator rbegin()                         noexcept { return reverse_iterator(end()); }
+		constexpr const_reverse_iterator rbegin()             const noexcept { return const_reverse_iterator(end()); }
+		constexpr reverse_iterator rend()                           noexcept { return reverse_iterator(begin()); }
+		constexpr const_reverse_iterator rend()               const noexcept { return const_reverse_iterator(begin()); }
+
+		constexpr out_edge_t& operator[](std::size_t index)         noexcept { assert(index < size()); return m_first[index]; }
+		constexpr out_edge_t const& operator[](std::size_t index) const noexcept { assert(index < size()); return m_first[index]; }
+	};
+
+	namespace detail
+	{
+		// We need this base class because we need a standard layout type for offsetof.
+		// See adjacency_list_base.
+		template<
+			typename edge_properties_t,
+			typename vertex_properties_t,
+			typename index_t,
+			typename derived_t
+		>
+		class csr_graph_base
+		{
+			using out_edges_t = std::vector<out_edge<edge_properties_t, index_t>>;
+			using vertices_t = std::vector<::quiver::vertex<vertex_properties_t, out_edge_span<out_edge<edge_properties_t, index_t>>>>;
+			using csr_graph = derived_t;
+			using vertex_span_type = vertex_span_t<csr_graph, csr_graph_base>;
+			friend vertex_span_type;
+			using edge_span_type = edge_span_t<csr_graph, csr_graph_base>;
+			friend edge_span_type;
+
+		protected:
+			// private:
+			vertices_t m_vertices;
+			out_edges_t m_out_edges; // the out-edges of all vertices, stored back to back in vertex order
+
+			// public:
+			vertex_span_type V; // when renaming, the corresponding offsetof invocation must be changed too
+			edge_span_type E; // when renaming, the corresponding offsetof invocation must be changed too
+
+			csr_graph_base() noexcept
+			{
+			}
+
+			csr_graph_base(csr_graph_base const& rhs)
+			: m_vertices(rhs.m_vertices), m_out_edges(rhs.m_out_edges)
+			{
+				rebase(rhs.m_out_edges.data());
+			}
+			// std::vector's move constructor keeps the buffer, so the spans stay valid
+			csr_graph_base(csr_graph_base&& rhs) noexcept
+			: m_vertices(std::move(rhs.m_vertices)), m_out_edges(std::move(rhs.m_out_edges))
+			{
+			}
+
+			csr_graph_base& operator=(csr_graph_base const& rhs)
+			{
+				return *this = csr_graph_base(rhs);
+			}
+			csr_graph_base& operator=(csr_graph_base&& rhs) noexcept
+			{
+				m_vertices = std::move(rhs.m_vertices);
+				m_out_edges = std::move(rhs.m_out_edges);
+				return *this;
+			}
+
+			// makes the spans of all vertices point into m_out_edges instead of old_data
+			void rebase(typename out_edges_t::value_type const* old_data) noexcept
+			{
+				for(auto& vertex : m_vertices) {
+					const std::size_t first = vertex.out_edges.begin() - old_data;
+					const std::size_t last = vertex.out_edges.end() - old_data;
+					vertex.out_edges = { m_out_edges.data() + first, m_out_edges.data() + last };
+				}
+			}
+		};
+	}
+
+	// Immutable compressed sparse row representation of a graph.
+	// All out-edges are stored in one contiguous array, ordered by their source vertex.
+	// Vertex and edge properties stay mutable, the structure of the graph does not.
+	template<
+		directivity_t dir = directed,
+		typename edge_properties_t = void,
+		typename vertex_properties_t = void,
+		typename index_t = vertex_index_t
+	>
+	class csr_graph : private detail::csr_graph_base<edge_properties_t, vertex_properties_t, index_t, csr_graph<dir, edge_properties_t, vertex_properties_t, index_t>>
+	{
+		using base_t = detail::csr_graph_base<edge_properties_t, vertex_properties_t, index_t, csr_graph>;
+
+	public:
+		using vertex_index_type = index_t;
+		using edge_t = edge<edge_properties_t, vertex_index_type>;
+		using out_edge_t = out_edge<edge_properties_t, vertex_index_type>;
+		using out_edge_list_t = out_edge_span<out_edge_t>;
+
+		using vertex_t = ::quiver::vertex<vertex_properties_t, out_edge_list_t>;
+		using vertices_t = std::vector<vertex_t>;
+
+		using adjacency_list_t = adjacency_list<dir, edge_properties_t, vertex_properties_t, vector, vector, vertex_index_type>;
+
+		inline static constexpr directivity_t directivity = dir;
+
+	private:
+		using base_t::m_vertices;
+		static_assert(std::is_same_v<decltype(m_vertices), vertices_t>);
+		using base_t::m_out_edges;
+
+		static constexpr void normalize(vertex_index_t& from, vertex_index_t& to) noexcept
+		{
+			if(from > to)
+				std::swap(from, to);
+		}
+
+		// accessible through .V
+		constexpr std::size_t vertex_size() const noexcept			{ return m_vertices.size(); }
+		constexpr bool vertex_empty() const noexcept				{ return m_vertices.empty(); }
+		constexpr std::size_t vertex_capacity() const noexcept		{ return m_vertices.capacity(); }
+
+		constexpr auto vertex_begin() noexcept						{ return m_vertices.begin(); }
+		constexpr auto vertex_begin() const noexcept				{ return m_vertices.begin(); }
+		constexpr auto vertex_cbegin() const noexcept				{ return m_vertices.cbegin(); }
+		constexpr auto vertex_end() noexcept						{ return m_vertices.end(); }
+		constexpr auto vertex_end() const noexcept					{ return m_vertices.end(); }
+		constexpr auto vertex_cend() const noexcept					{ return m_vertices.cend(); }
+
+		constexpr vertex_t const& vertex_get(vertex_index_t index) const noexcept
+		{
+			assert(index < m_vertices.size());
+			return m_vertices[index];
+		}
+		constexpr vertex_t& vertex_get(vertex_index_t index) noexcept
+		{
+			return const_cast<vertex_t&>(std::as_const(*this).vertex_get(index));
+		}
+
+		// accessible through .E
+		constexpr std::size_t edge_size() const noexcept
+		{
+			if constexpr(directivity == directed)
+				return m_out_edges.size();
+			else if constexpr(directivity == undirected)
+				return m_out_edges.size() / 2;
+		}
+		constexpr bool edge_empty() const noexcept
+		{
+			return m_out_edges.empty();
+		}
+		constexpr std::size_t edge_max_size() const noexcept
+		{
+			if constexpr(directivity == directed)
+				return V.size() * (V.size() - 1);
+			else if constexpr(directivity == undirected)
+				return V.size() * (V.size() - 1) / 2;
+		}
+
+		constexpr out_edge_t const* edge_get(vertex_index_t from, vertex_index_t to) const noexcept
+		{
+			assert(from < V.size());
+			assert(to < V.size());
+
+			if constexpr(directivity == undirected)
+				normalize(from, to); // so that edge_get(1,0) == edge_get(0,1)
+			for(out_edge_t const& out_edge : m_vertices[from].out_edges)
+				if(out_edge.to == to)
+					return &out_edge;
+			return nullptr;
+		}
+
+	public:
+		csr_graph() noexcept = default;
+
+		// time complexity:  O(V + E)
+		template<template<typename> class out_edge_container, template<typename> class vertex_container, template<typename> class in_edge_container>
+		explicit csr_graph(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, vertex_index_type, in_edge_container> const& graph)
+		{
+			std::vector<std::size_t> offsets;
+			offsets.reserve(graph.V.size() + 1);
+			{
+				std::size_t out_edges = 0;
+				for(auto const& vertex : graph.V)
+					out_edges += vertex.out_degree();
+				m_out_edges.reserve(out_edges);
+			}
+			m_vertices.reserve(graph.V.size());
+			offsets.push_back(0);
+			for(auto const& vertex : graph.V) {
+				m_vertices.emplace_back(vertex.properties());
+				m_out_edges.insert(m_out_edges.end(), vertex.out_edges.begin(), vertex.out_edges.end());
+				offsets.push_back(m_out_edges.size());
+			}
+			for(vertex_index_t v = 0; v < m_vertices.size(); ++v)
+				m_vertices[v].out_edges = { m_out_edges.data() + offsets[v], m_out_edges.data() + offsets[v + 1] };
+		}
+
+		using vertex_span_type = detail::vertex_span_t<csr_graph, base_t>;
+		friend vertex_span_type;
+		using base_t::V;
+		static_assert(std::is_same_v<decltype(V), vertex_span_type>);
+
+		using edge_span_type = detail::edge_span_t<csr_graph, base_t>;
+		friend edge_span_type;
+		using base_t::E;
+		static_assert(std::is_same_v<decltype(E), edge_span_type>);
+
+		std::size_t in_degree(vertex_index_t index) const noexcept
+		{
+			if constexpr(directivity == directed) {
+				std::size_t count = 0;
+				for(out_edge_t const& out_edge : m_out_edges)
+					count += out_edge.to == index;
+				return count;
+			} else if constexpr(directivity == undirected) {
+				return out_degree(index);
+			}
+		}
+		std::size_t out_degree(vertex_index_t index) const noexcept
+		{
+			return V[index].out_degree();
+		}
+		std::size_t degree(vertex_index_t index) const noexcept
+		{
+			static_assert(directivity == undirected, "degree only defined for undirected graphs");
+			return out_degree(index);
+		}
+
+		// returns a mutable graph with the same vertices but no edges; see adjacency_list::strip_edges
+		adjacency_list_t strip_edges() const
+		{
+			adjacency_list_t result;
+			result.V.reserve(V.size());
+			for(auto const& vertex : m_vertices)
+				result.V.emplace(vertex.properties());
+			return result;
+		}
+
+		// time complexity:  O(V + E)
+		template<template<typename> class out_edge_container = vector, template<typename> class vertex_container = vector>
+		adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, vertex_index_type> to_adjacency_list() const
+		{
+			using result_t = adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, vertex_index_type>;
+			result_t result;
+			result.V.reserve(V.size());
+			for(auto const& vertex : m_vertices) {
+				typename result_t::vertex_t copy(vertex.properties());
+				copy.out_edges.insert(copy.out_edges.end(), vertex.out_edges.begin(), vertex.out_edges.end());
+				result.V.emplace(std::move(copy));
+			}
+			return result;
+		}
+
+		void swap(csr_graph& rhs) noexcept
+		{
+			using std::swap;
+			swap(m_vertices, rhs.m_vertices);
+			swap(m_out_edges, rhs.m_out_edges);
+		}
+
+		static constexpr bool is_weighted() noexcept
+		{
+			return is_weighted_v<csr_graph>;
+		}
+		static constexpr bool is_simple() noexcept
+		{
+			return !is_weighted() && directivity == undirected;
+		}
+	};
+
+	template<directivity_t dir, typename edge_properties_t, typename vertex_properties_t, typename index_t>
+	void swap(csr_graph<dir, edge_properties_t, vertex_properties_t, index_t>& lhs, csr_graph<dir, edge_properties_t, vertex_properties_t, index_t>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+
+	template<directivity_t dir, typename edge_properties_t, typename vertex_properties_t, template<typename> class out_edge_container, template<typename> class vertex_container, typename index_t, template<typename> class in_edge_container>
+	csr_graph(adjacency_list<dir, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t, in_edge_container> const&) -> csr_graph<dir, edge_properties_t, vertex_properties_t, index_t>;
+}
+
+#endif // !QUIVER_CSR_GRAPH_HPP_INCLUDED
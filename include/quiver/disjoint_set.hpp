@@ -11,6 +11,9 @@
 // #include <quiver/adjacency_list.hpp>
 #include <vector>
 #include <numeric>
+#include <limits>
+#include <type_traits>
+#include <cstddef>
 #include <cassert>
 
 namespace quiver
@@ -23,93 +26,98 @@ namespace quiver
 		path_splitting		// O(a(n)) time
 	};
 
-	template<typename derived_t, disjoint_set_find_strategy_t>
+	template<typename derived_t, disjoint_set_find_strategy_t, typename index_t>
 	class disjoint_set_find_injector;
-	template<typename derived_t>
-	class disjoint_set_find_injector<derived_t, naive>
+	template<typename derived_t, typename index_t>
+	class disjoint_set_find_injector<derived_t, naive, index_t>
 	{
 		auto&& derived() const noexcept	{ return static_cast<derived_t const&>(*this); }
 		auto&& derived()       noexcept	{ return static_cast<derived_t      &>(*this); }
 
 	public:
-		std::size_t find(std::size_t index) const noexcept
+		index_t find(index_t index) const noexcept
 		{
-			std::size_t next;
+			index_t next;
 			while(index != (next = derived().m_parent[index]))
 				index = next;
 			return index;
 		}
 	};
-	template<typename derived_t>
-	class disjoint_set_find_injector<derived_t, path_compression>
+	template<typename derived_t, typename index_t>
+	class disjoint_set_find_injector<derived_t, path_compression, index_t>
 	{
 		auto&& derived() const noexcept	{ return static_cast<derived_t const&>(*this); }
 		auto&& derived()       noexcept	{ return static_cast<derived_t      &>(*this); }
 
 	public:
-		std::size_t find(std::size_t index) noexcept
+		index_t find(index_t index) noexcept
 		{
-			const std::size_t start = index;
-			for(std::size_t next; index != (next = derived().m_parent[index]); index = next);
-			const std::size_t root = index;
+			const index_t start = index;
+			for(index_t next; index != (next = derived().m_parent[index]); index = next);
+			const index_t root = index;
 			index = start;
-			for(std::size_t next; index != (next = derived().m_parent[index]); index = next)
+			for(index_t next; index != (next = derived().m_parent[index]); index = next)
 				derived().m_parent[index] = root;
 			return root;
 		}
 	};
-	template<typename derived_t>
-	class disjoint_set_find_injector<derived_t, path_halving>
+	template<typename derived_t, typename index_t>
+	class disjoint_set_find_injector<derived_t, path_halving, index_t>
 	{
 		auto&& derived() const noexcept	{ return static_cast<derived_t const&>(*this); }
 		auto&& derived()       noexcept	{ return static_cast<derived_t      &>(*this); }
 
 	public:
-		std::size_t find(std::size_t index) noexcept
+		index_t find(index_t index) noexcept
 		{
 			while(index != derived().m_parent[index])
 				index = derived().m_parent[index] = derived().m_parent[derived().m_parent[index]];
 			return index;
 		}
 	};
-	template<typename derived_t>
-	class disjoint_set_find_injector<derived_t, path_splitting>
+	template<typename derived_t, typename index_t>
+	class disjoint_set_find_injector<derived_t, path_splitting, index_t>
 	{
 		auto&& derived() const noexcept	{ return static_cast<derived_t const&>(*this); }
 		auto&& derived()       noexcept	{ return static_cast<derived_t      &>(*this); }
 
 	public:
-		std::size_t find(std::size_t index) noexcept
+		index_t find(index_t index) noexcept
 		{
-			for(std::size_t next; index != (next = derived().m_parent[index]); index = next)
+			for(index_t next; index != (next = derived().m_parent[index]); index = next)
 				derived().m_parent[index] = derived().m_parent[next];
 			return index;
 		}
 	};
 
+	// index_t is the type of the stored parent indices and cardinalities; it must be able to represent size().
 	template<
-		disjoint_set_find_strategy_t find_strategy_ = path_splitting
+		disjoint_set_find_strategy_t find_strategy_ = path_splitting,
+		typename index_t = std::size_t
 	>
-	class disjoint_set : public disjoint_set_find_injector<disjoint_set<find_strategy_>, find_strategy_>
+	class disjoint_set : public disjoint_set_find_injector<disjoint_set<find_strategy_, index_t>, find_strategy_, index_t>
 	{
-		using base_t = disjoint_set_find_injector<disjoint_set<find_strategy_>, find_strategy_>;
+		static_assert(std::is_unsigned_v<index_t>, "index_t must be an unsigned integer type");
+
+		using base_t = disjoint_set_find_injector<disjoint_set<find_strategy_, index_t>, find_strategy_, index_t>;
 		friend base_t;
 
-		std::vector<std::size_t> m_parent;
-		std::vector<std::size_t> m_card;
+		std::vector<index_t> m_parent;
+		std::vector<index_t> m_card;
 		std::size_t m_sets = 0;
 
-		bool check_size_invariant(std::size_t index)
+		bool check_size_invariant(index_t index)
 		{
 			const std::size_t card = cardinality(index);
 			std::size_t N = 0;
-			for(std::size_t i = 0; i < size(); ++i)
+			for(index_t i = 0; i < size(); ++i)
 				N += same_set(i, index);
 			return card == N;
 		}
 
 	public:
 		static constexpr disjoint_set_find_strategy_t find_strategy = find_strategy_;
+		using index_type = index_t;
 
 		disjoint_set() noexcept = default;
 		explicit disjoint_set(std::size_t size)
@@ -119,9 +127,10 @@ namespace quiver
 
 		void reset(std::size_t size)
 		{
+			assert(size <= std::numeric_limits<index_t>::max());
 			m_card.resize(size, 1);
 			m_parent.resize(size);
-			std::iota(m_parent.begin(), m_parent.end(), std::size_t{});
+			std::iota(m_parent.begin(), m_parent.end(), index_t{});
 			m_sets = size;
 		}
 
@@ -135,22 +144,22 @@ namespace quiver
 			return m_sets;
 		}
 
-		// std::size_t find(std::size_t index) /* const */ noexcept;
+		// index_t find(index_t index) /* const */ noexcept;
 		using base_t::find;
 
-		bool unite(std::size_t a, std::size_t b) noexcept
+		bool unite(index_t a, index_t b) noexcept
 		{
 			// find a's and b's roots
-			const std::size_t a_root = find(a);
-			const std::size_t b_root = find(b);
+			const index_t a_root = find(a);
+			const index_t b_root = find(b);
 
 			// a and b already belong to the same set
 			if(a_root == b_root)
 				return false;
 
 			// sort a and b by the cardinality of their respective sets
-			const std::size_t min_root = m_card[a_root] < m_card[b_root] ? a_root : b_root;
-			const std::size_t max_root = m_card[a_root] < m_card[b_root] ? b_root : a_root;
+			const index_t min_root = m_card[a_root] < m_card[b_root] ? a_root : b_root;
+			const index_t max_root = m_card[a_root] < m_card[b_root] ? b_root : a_root;
 
 			// attach the small tree to the large tree
 			m_parent[min_root] = max_root;
@@ -166,12 +175,12 @@ namespace quiver
 			return true;
 		}
 
-		std::size_t cardinality(std::size_t index) /* const */ noexcept
+		std::size_t cardinality(index_t index) /* const */ noexcept
 		{
 			return m_card[find(index)];
 		}
 
-		bool same_set(std::size_t a, std::size_t b) /* const */ noexcept
+		bool same_set(index_t a, index_t b) /* const */ noexcept
 		{
 			return a == b || find(a) == find(b);
 		}
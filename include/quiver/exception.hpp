@@ -16,6 +16,14 @@ namespace quiver
 	{
 		using std::invalid_argument::invalid_argument;
 	};
+	struct negative_cycle : public std::invalid_argument
+	{
+		using std::invalid_argument::invalid_argument;
+	};
+	struct malformed_input : public std::runtime_error
+	{
+		using std::runtime_error::runtime_error;
+	};
 }
 
 #endif // !QUIVER_EXCEPTION_HPP_INCLUDED
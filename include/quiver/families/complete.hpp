@@ -18,12 +18,13 @@ namespace quiver
 		typename edge_properties_t = void,
 		typename vertex_properties_t = void,
 		template<typename> class out_edge_container = vector,
-		template<typename> class vertex_container = vector
+		template<typename> class vertex_container = vector,
+		typename index_t = vertex_index_t
 	>
-	adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+	adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
 	complete(std::size_t n)
 	{
-		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> result(n);
+		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> result(n);
 		for(auto& vert : result.V)
 			vert.out_edges.reserve(n - 1);
 		for(std::size_t i = 1; i < n; ++i)
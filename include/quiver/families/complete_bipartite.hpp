@@ -17,12 +17,13 @@ namespace quiver
 		typename edge_properties_t = void,
 		typename vertex_properties_t = void,
 		template<typename> class out_edge_container = vector,
-		template<typename> class vertex_container = vector
+		template<typename> class vertex_container = vector,
+		typename index_t = vertex_index_t
 	>
-	adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+	adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
 	complete_bipartite(std::size_t m, std::size_t n)
 	{
-		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> result(m + n);
+		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> result(m + n);
 		{
 			std::size_t i = 0;
 			while(i < n)
@@ -44,12 +45,13 @@ namespace quiver
 		typename edge_properties_t = void,
 		typename vertex_properties_t = void,
 		template<typename> class out_edge_container = vector,
-		template<typename> class vertex_container = vector
+		template<typename> class vertex_container = vector,
+		typename index_t = vertex_index_t
 	>
-	adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+	adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
 	star(std::size_t n)
 	{
-		return complete_bipartite<edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>(n, 1);
+		return complete_bipartite<edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>(n, 1);
 	}
 	inline auto star(std::size_t n)
 	{
@@ -60,12 +62,13 @@ namespace quiver
 		typename edge_properties_t = void,
 		typename vertex_properties_t = void,
 		template<typename> class out_edge_container = vector,
-		template<typename> class vertex_container = vector
+		template<typename> class vertex_container = vector,
+		typename index_t = vertex_index_t
 	>
-	adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+	adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
 	claw()
 	{
-		return star<edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>(3);
+		return star<edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>(3);
 	}
 	inline auto claw()
 	{
@@ -21,13 +21,14 @@ namespace quiver
 		typename edge_properties_t = void,
 		typename vertex_properties_t = void,
 		template<typename> class out_edge_container = vector,
-		template<typename> class vertex_container = vector
+		template<typename> class vertex_container = vector,
+		typename index_t = vertex_index_t
 	>
-	adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container>
+	adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t>
 	wheel(std::size_t n)
 	{
 		assert(n >= 4);
-		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> result(n);
+		adjacency_list<undirected, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container, index_t> result(n);
 		result.V[0].out_edges.reserve(n - 1);
 		for(auto iter = std::next(result.V.begin()); iter != result.V.end(); ++iter)
 			iter->out_edges.reserve(3);
@@ -0,0 +1,239 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_HASH_INDEXED_VECTOR_HPP_INCLUDED
+#define QUIVER_HASH_INDEXED_VECTOR_HPP_INCLUDED
+
+#include <quiver/container_traits.hpp>
+#include <quiver/typedefs.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <vector>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+
+namespace quiver
+{
+	// A vector of out-edges for graphs with a few vertices of very high degree. As long as it holds fewer than
+	// threshold elements, it is a flat vector which is searched linearly. Beyond that, it additionally keeps an
+	// open addressing hash index from the member to of every element to its position, which makes find, and
+	// thus E(from, to), E.emplace and E.erase of adjacency_list, O(1) on average.
+	// erase moves the last element into the gap and hence doesn't preserve the order of the elements.
+	// The index is not aware of changes to the member to through an iterator: unindex has to be called before and
+	// reindex after such changes, which adjacency_list does for the operations which relabel vertices.
+	template<typename T, std::size_t threshold = 64>
+	class hash_indexed_vector
+	{
+		// home shifts by 64 minus the bits of the slot count, so the index needs at least 2 slots
+		static_assert(threshold > 0, "threshold must be positive");
+
+	public:
+		using container_type = std::vector<T>;
+		using value_type = T;
+		using size_type = typename container_type::size_type;
+		using difference_type = typename container_type::difference_type;
+		using reference = typename container_type::reference;
+		using const_reference = typename container_type::const_reference;
+		using iterator = typename container_type::iterator;
+		using const_iterator = typename container_type::const_iterator;
+		using reverse_iterator = typename container_type::reverse_iterator;
+		using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+		inline static constexpr std::size_t index_threshold = threshold;
+
+	private:
+		// 0 marks an empty slot, any other value is one more than the position of an element
+		using slot_t = std::uint32_t;
+
+		container_type m_values;
+		std::vector<slot_t> m_slots;
+		bool m_indexing = true;
+
+		static vertex_index_t key(value_type const& value) noexcept
+		{
+			return static_cast<vertex_index_t>(value.to);
+		}
+		// Fibonacci hashing
+		std::size_t home(vertex_index_t key) const noexcept
+		{
+			const std::uint64_t hash = static_cast<std::uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+			return static_cast<std::size_t>(hash >> (64 - std::countr_zero(m_slots.size())));
+		}
+		bool indexed() const noexcept
+		{
+			return !m_slots.empty();
+		}
+		// the slot which holds key or the empty slot at which the probing for it ends
+		std::size_t probe(vertex_index_t key) const noexcept
+		{
+			const std::size_t mask = m_slots.size() - 1;
+			std::size_t slot = home(key);
+			while(m_slots[slot] != 0 && this->key(m_values[m_slots[slot] - 1]) != key)
+				slot = (slot + 1) & mask;
+			return slot;
+		}
+		void insert_slot(std::size_t position) noexcept
+		{
+			const std::size_t slot = probe(key(m_values[position]));
+			assert(m_slots[slot] == 0);
+			m_slots[slot] = static_cast<slot_t>(position + 1);
+		}
+		// backward shift deletion, which leaves no tombstones behind
+		void erase_slot(std::size_t slot) noexcept
+		{
+			const std::size_t mask = m_slots.size() - 1;
+			for(std::size_t next = (slot + 1) & mask; m_slots[next] != 0; next = (next + 1) & mask) {
+				const std::size_t next_home = home(key(m_values[m_slots[next] - 1]));
+				// the entry at next may fill the gap at slot iff its home isn't cyclically within (slot, next]
+				if(((next - next_home) & mask) >= ((next - slot) & mask)) {
+					m_slots[slot] = m_slots[next];
+					slot = next;
+				}
+			}
+			m_slots[slot] = 0;
+		}
+		// rebuilds the index with room for at least twice the elements, or drops it below threshold
+		void rehash(std::size_t capacity)
+		{
+			if(!m_indexing || m_values.size() < threshold) {
+				m_slots.clear();
+				return;
+			}
+			assert(m_values.size() < std::numeric_limits<slot_t>::max());
+			m_slots.assign(std::bit_ceil(std::max<std::size_t>(2 * capacity, 2 * threshold)), 0);
+			for(std::size_t position = 0; position < m_values.size(); ++position)
+				insert_slot(position);
+		}
+
+	public:
+		hash_indexed_vector() noexcept = default;
+
+		std::size_t size() const noexcept		{ return m_values.size(); }
+		bool empty() const noexcept				{ return m_values.empty(); }
+		std::size_t capacity() const noexcept	{ return m_values.capacity(); }
+		void reserve(std::size_t capacity)		{ m_values.reserve(capacity); }
+
+		iterator begin() noexcept				{ return m_values.begin(); }
+		const_iterator begin() const noexcept	{ return m_values.begin(); }
+		const_iterator cbegin() const noexcept	{ return m_values.cbegin(); }
+		iterator end() noexcept					{ return m_values.end(); }
+		const_iterator end() const noexcept		{ return m_values.end(); }
+		const_iterator cend() const noexcept	{ return m_values.cend(); }
+
+		reverse_iterator rbegin() noexcept					{ return m_values.rbegin(); }
+		const_reverse_iterator rbegin() const noexcept		{ return m_values.rbegin(); }
+		const_reverse_iterator crbegin() const noexcept		{ return m_values.crbegin(); }
+		reverse_iterator rend() noexcept					{ return m_values.rend(); }
+		const_reverse_iterator rend() const noexcept		{ return m_values.rend(); }
+		const_reverse_iterator crend() const noexcept		{ return m_values.crend(); }
+
+		reference operator[](std::size_t position) noexcept				{ return m_values[position]; }
+		const_reference operator[](std::size_t position) const noexcept	{ return m_values[position]; }
+		reference back() noexcept										{ return m_values.back(); }
+		const_reference back() const noexcept							{ return m_values.back(); }
+
+		// the element whose member to equals key, or end()
+		iterator find(vertex_index_t key) noexcept
+		{
+			if(!indexed())
+				return std::find_if(begin(), end(), [key](value_type const& value){ return hash_indexed_vector::key(value) == key; });
+			const slot_t slot = m_slots[probe(key)];
+			return slot == 0 ? end() : begin() + (slot - 1);
+		}
+		const_iterator find(vertex_index_t key) const noexcept
+		{
+			return const_cast<hash_indexed_vector&>(*this).find(key);
+		}
+
+		template<typename... args_t>
+		reference emplace_back(args_t&&... args)
+		{
+			m_values.emplace_back(std::forward<args_t>(args)...);
+			if(indexed() && 2 * m_values.size() <= m_slots.size())
+				insert_slot(m_values.size() - 1);
+			else if(m_indexing && m_values.size() >= threshold)
+				rehash(m_values.size());
+			return m_values.back();
+		}
+		// inserting anywhere but at the end shifts the positions of the following elements, so the index is rebuilt
+		template<typename input_iterator_t>
+		iterator insert(const_iterator position, input_iterator_t first, input_iterator_t last)
+		{
+			const iterator result = m_values.insert(position, first, last);
+			rehash(m_values.size());
+			return result;
+		}
+		// moves the last element to position; returns the iterator to position
+		iterator erase(const_iterator position)
+		{
+			const std::size_t gap = static_cast<std::size_t>(position - cbegin());
+			const std::size_t last = m_values.size() - 1;
+			assert(gap <= last);
+			if(indexed()) {
+				erase_slot(probe(key(m_values[gap])));
+				if(gap != last)
+					m_slots[probe(key(m_values[last]))] = static_cast<slot_t>(gap + 1);
+			}
+			if(gap != last)
+				m_values[gap] = std::move(m_values[last]);
+			m_values.pop_back();
+			return begin() + gap;
+		}
+		void clear() noexcept
+		{
+			m_values.clear();
+			m_slots.clear();
+		}
+
+		// suspends the index, e.g. before the members to are changed through iterators
+		void unindex() noexcept
+		{
+			m_indexing = false;
+			m_slots.clear();
+		}
+		// rebuilds the index from the current members to
+		void reindex()
+		{
+			m_indexing = true;
+			rehash(m_values.size());
+		}
+
+		void swap(hash_indexed_vector& rhs) noexcept
+		{
+			using std::swap;
+			swap(m_values, rhs.m_values);
+			swap(m_slots, rhs.m_slots);
+			swap(m_indexing, rhs.m_indexing);
+		}
+	};
+
+	template<typename T, std::size_t threshold>
+	void swap(hash_indexed_vector<T, threshold>& lhs, hash_indexed_vector<T, threshold>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+
+	template<typename T, std::size_t threshold>
+	struct container_traits<hash_indexed_vector<T, threshold>>
+	{
+		static constexpr bool is_specialized = true;
+		// erase doesn't preserve the order, so sorting would be in vain
+		static constexpr bool is_ordered = false;
+		static constexpr lookup_t lookup = lookup_t::hash;
+
+		using container_type = hash_indexed_vector<T, threshold>;
+		using value_type = T;
+		template<typename U>
+		using rebind = hash_indexed_vector<U, threshold>;
+	};
+}
+
+#endif // !QUIVER_HASH_INDEXED_VECTOR_HPP_INCLUDED
@@ -8,6 +8,13 @@
 #ifndef QUIVER_HEAPS_HPP_INCLUDED
 #define QUIVER_HEAPS_HPP_INCLUDED
 
+#include <quiver/heaps/concepts.hpp>
 #include <quiver/heaps/binary_heap.hpp>
+#include <quiver/heaps/d_ary_heap.hpp>
+#include <quiver/heaps/pairing_heap.hpp>
+#include <quiver/heaps/fibonacci_heap.hpp>
+#include <quiver/heaps/radix_heap.hpp>
+#include <quiver/heaps/bucket_queue.hpp>
+#include <quiver/heaps/monotone_heap_policy.hpp>
 
 #endif // !QUIVER_HEAPS_HPP_INCLUDED
@@ -8,29 +8,42 @@
 #ifndef QUIVER_HEAPS_BINARY_HEAP_HPP_INCLUDED
 #define QUIVER_HEAPS_BINARY_HEAP_HPP_INCLUDED
 
+#include <quiver/heaps/concepts.hpp>
 #include <functional>
 #include <vector>
 #include <cassert>
 #include <utility>
 #include <iterator>
+#include <type_traits>
+#include <cstddef>
 
 namespace quiver
 {
-	template<typename T, typename comparator_t = std::less<>, typename container_t = std::vector<T>>
+	template<typename T, typename comparator_t = std::less<>, typename container_t = std::vector<T>, typename position_tracker_t = null_position_tracker>
 	class binary_heap
 	{
 	public:
 		using value_type = T;
 		using comparator_type = comparator_t;
 		using container_type = container_t;
+		using position_tracker_type = position_tracker_t;
+		// the index of a value in the container
+		using handle_type = std::size_t;
+		static constexpr handle_type null_handle = ~handle_type{};
 
 	private:
 		container_type m_container;
 		comparator_type m_comparator;
+		[[no_unique_address]] position_tracker_type m_position_tracker;
 
 		static constexpr std::size_t up(std::size_t index) noexcept		{ return (index - 1) / 2; }
 		static constexpr std::size_t down(std::size_t index) noexcept	{ return 2 * index + 1; }
 
+		void track(std::size_t index)
+		{
+			m_position_tracker(std::as_const(m_container[index]), index);
+		}
+
 		std::size_t sift_up(std::size_t index)
 		{
 			assert(index < m_container.size());
@@ -39,11 +52,13 @@ namespace quiver
 				if(m_comparator(m_container[index], m_container[parent])) {
 					using std::swap;
 					swap(m_container[index], m_container[parent]);
+					track(index);
 					index = parent;
 				} else {
 					break;
 				}
 			}
+			track(index);
 			return index;
 		}
 		std::size_t sift_down(std::size_t index)
@@ -58,11 +73,13 @@ namespace quiver
 				if(m_comparator(m_container[child], m_container[index])) {
 					using std::swap;
 					swap(m_container[child], m_container[index]);
+					track(index);
 					index = child;
 				} else {
 					break;
 				}
 			}
+			track(index);
 			return index;
 		}
 
@@ -82,6 +99,9 @@ namespace quiver
 		{
 			for(std::size_t i = size() / 2; i--;)
 				sift_down(i);
+			if constexpr(!std::is_same_v<position_tracker_type, null_position_tracker>)
+				for(std::size_t i = size() / 2; i < size(); ++i) // the leaves may not have been touched by sift_down
+					track(i);
 			assert(is_heap());
 		}
 
@@ -93,6 +113,10 @@ namespace quiver
 		: m_comparator(std::move(comparator))
 		{
 		}
+		binary_heap(comparator_t comparator, position_tracker_t position_tracker)
+		: m_comparator(std::move(comparator)), m_position_tracker(std::move(position_tracker))
+		{
+		}
 		// TODO: ctors
 		// TODO: assign or make_heap
 
@@ -161,7 +185,8 @@ namespace quiver
 			assert(index < m_container.size());
 			value_type replacement(std::move(m_container.back()));
 			m_container.pop_back();
-			update(index, std::move(replacement));
+			if(index != m_container.size())
+				update(index, std::move(replacement));
 		}
 		// a.k.a. 'remove_min'
 		void pop()
@@ -229,15 +254,23 @@ namespace quiver
 			using std::swap;
 			swap(m_comparator, rhs.m_comparator);
 			swap(m_container, rhs.m_container);
+			swap(m_position_tracker, rhs.m_position_tracker);
 		}
 	};
 
-	template<typename T, typename comparator_t, typename container_t>
-	void swap(binary_heap<T, comparator_t, container_t>& lhs, binary_heap<T, comparator_t, container_t>& rhs) noexcept
+	template<typename T, typename comparator_t, typename container_t, typename position_tracker_t>
+	void swap(binary_heap<T, comparator_t, container_t, position_tracker_t>& lhs, binary_heap<T, comparator_t, container_t, position_tracker_t>& rhs) noexcept
 	{
 		lhs.swap(rhs);
 	}
 
+	// heap policies select the queue of a search algorithm, e.g. dijkstra
+	struct binary_heap_policy
+	{
+		template<typename T, typename position_tracker_t = null_position_tracker>
+		using templ = binary_heap<T, std::less<>, std::vector<T>, position_tracker_t>;
+	};
+
 	template<typename T, typename container_t = std::vector<T>>
 	using min_heap = binary_heap<T, std::less<>, container_t>;
 	template<typename T, typename container_t = std::vector<T>>
@@ -0,0 +1,165 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_HEAPS_BUCKET_QUEUE_HPP_INCLUDED
+#define QUIVER_HEAPS_BUCKET_QUEUE_HPP_INCLUDED
+
+#include <quiver/heaps/concepts.hpp>
+#include <quiver/heaps/radix_heap.hpp>
+#include <functional>
+#include <type_traits>
+#include <concepts>
+#include <vector>
+#include <bit>
+#include <cassert>
+#include <utility>
+#include <cstddef>
+
+namespace quiver
+{
+	// Dial's monotone min heap for small unsigned integer keys, obtained by invoking projection on the values.
+	// Keys must never be less than the key of the last value returned by top, as in Dijkstra's algorithm, and
+	// all keys lie within a window above it which is as wide as the heaviest edge. That window is mapped onto a
+	// circle of buckets, one per key, which doubles whenever a key falls beyond it; reserve sizes it in advance
+	// if the heaviest edge is known. top is thus amortized O(1) plus the number of empty buckets skipped.
+	template<typename T, typename projection_t = std::identity>
+	class bucket_queue
+	{
+	public:
+		using value_type = T;
+		using projection_type = projection_t;
+		using key_type = std::remove_cvref_t<std::invoke_result_t<projection_t const&, T const&>>;
+		static_assert(std::unsigned_integral<key_type>, "bucket queues require unsigned integral keys");
+
+	private:
+		// top has to advance the cursor, which is not observable from outside
+		mutable std::vector<std::vector<value_type>> m_buckets = std::vector<std::vector<value_type>>(1);
+		mutable key_type m_cursor = 0;
+		std::size_t m_size = 0;
+		[[no_unique_address]] projection_type m_projection;
+
+		key_type key(value_type const& value) const
+		{
+			return m_projection(value);
+		}
+		std::vector<value_type>& bucket(key_type key) const noexcept
+		{
+			return m_buckets[static_cast<std::size_t>(key) & (m_buckets.size() - 1)];
+		}
+		void advance() const
+		{
+			assert(m_size != 0);
+			while(bucket(m_cursor).empty())
+				++m_cursor;
+		}
+		void grow(std::size_t span)
+		{
+			std::vector<std::vector<value_type>> buckets(std::bit_ceil(span));
+			buckets.swap(m_buckets);
+			for(std::vector<value_type>& source : buckets)
+				for(value_type& value : source)
+					bucket(key(value)).push_back(std::move(value));
+		}
+
+	public:
+		bucket_queue()
+		{
+		}
+		explicit bucket_queue(projection_t projection)
+		: m_projection(std::move(projection))
+		{
+		}
+
+		std::size_t size() const noexcept
+		{
+			return m_size;
+		}
+		bool empty() const noexcept
+		{
+			return size() == 0;
+		}
+		// also resets the lower bound of the keys
+		void clear()
+		{
+			for(auto& bucket : m_buckets)
+				bucket.clear();
+			m_cursor = 0;
+			m_size = 0;
+		}
+		// makes room for keys up to max_span above the lower bound, e.g. the heaviest edge in Dijkstra's algorithm
+		void reserve(key_type max_span)
+		{
+			if(static_cast<std::size_t>(max_span) >= m_buckets.size())
+				grow(static_cast<std::size_t>(max_span) + 1);
+		}
+
+		// a.k.a. 'find_min'
+		value_type const& top() const
+		{
+			assert(!empty());
+			advance();
+			return bucket(m_cursor).back();
+		}
+		// a.k.a. 'insert' or 'emplace'
+		template<typename... args_t>
+		void push(args_t&&... args)
+		{
+			value_type value(std::forward<args_t>(args)...);
+			const key_type value_key = key(value);
+			assert(value_key >= m_cursor);
+			reserve(static_cast<key_type>(value_key - m_cursor));
+			bucket(value_key).push_back(std::move(value));
+			++m_size;
+		}
+		// a.k.a. 'remove_min'
+		void pop()
+		{
+			assert(!empty());
+			advance();
+			bucket(m_cursor).pop_back();
+			--m_size;
+		}
+		// a.k.a. 'extract_min'
+		value_type extract_top()
+		{
+			assert(!empty());
+			advance();
+			std::vector<value_type>& source = bucket(m_cursor);
+			value_type result(std::move(source.back()));
+			source.pop_back();
+			--m_size;
+			return result;
+		}
+
+		void swap(bucket_queue& rhs) noexcept
+		{
+			using std::swap;
+			swap(m_buckets, rhs.m_buckets);
+			swap(m_cursor, rhs.m_cursor);
+			swap(m_size, rhs.m_size);
+			swap(m_projection, rhs.m_projection);
+		}
+	};
+
+	template<typename T, typename projection_t>
+	void swap(bucket_queue<T, projection_t>& lhs, bucket_queue<T, projection_t>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+
+	// for values with an unsigned integral member distance, such as the queue entries of dijkstra;
+	// bucket queues are not addressable and thus only suit dijkstra_strategy_t::always_insert
+	struct bucket_queue_policy
+	{
+		static constexpr bool keys_on_distance = true;
+
+		template<typename T, typename position_tracker_t = null_position_tracker>
+		using templ = bucket_queue<T, radix_heap_policy::projection>;
+	};
+}
+
+#endif // !QUIVER_HEAPS_BUCKET_QUEUE_HPP_INCLUDED
@@ -0,0 +1,59 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_HEAPS_CONCEPTS_HPP_INCLUDED
+#define QUIVER_HEAPS_CONCEPTS_HPP_INCLUDED
+
+#include <concepts>
+#include <cstddef>
+
+namespace quiver
+{
+	// A position tracker is invoked as tracker(value, handle) whenever the handle under which a heap
+	// stores value changes. Owners of a heap can use it to find their values again, e.g. for decrease.
+	struct null_position_tracker
+	{
+		template<typename T, typename handle_t>
+		constexpr void operator()(T const& value, handle_t const& handle) const noexcept
+		{
+			(void)value; // -Wunused-parameter
+			(void)handle; // -Wunused-parameter
+		}
+	};
+
+	// The operations a search algorithm requires from its queue.
+	template<typename heap_t>
+	concept priority_heap = requires(heap_t& heap, heap_t const& const_heap, typename heap_t::value_type value)
+	{
+		{ const_heap.size() } -> std::convertible_to<std::size_t>;
+		{ const_heap.empty() } -> std::convertible_to<bool>;
+		{ heap.top() } -> std::convertible_to<typename heap_t::value_type const&>;
+		heap.push(std::move(value));
+		heap.pop();
+		{ heap.extract_top() } -> std::same_as<typename heap_t::value_type>;
+		heap.clear();
+	};
+
+	// A heap whose values can be revisited through the handles reported to its position tracker.
+	// null_handle is never reported and can be used as a sentinel by the owner.
+	template<typename heap_t>
+	concept addressable_heap = priority_heap<heap_t> && requires(heap_t& heap, typename heap_t::handle_type handle, typename heap_t::value_type value)
+	{
+		{ heap_t::null_handle } -> std::convertible_to<typename heap_t::handle_type>;
+		{ heap.get(handle) } -> std::convertible_to<typename heap_t::value_type const&>;
+		heap.decrease(handle, std::move(value));
+	};
+
+	// Heap policies whose queues order the values by their member distance alone, whatever their operator<,
+	// declare keys_on_distance = true. Such queues only suit searches which order by the distance, e.g. not astar.
+	// Policies which only select such a queue for some value types T declare keys_on_distance_for<T> instead.
+	template<typename heap_policy_t, typename T = void>
+	inline constexpr bool keys_on_distance_v = requires { requires heap_policy_t::keys_on_distance; }
+		|| requires { requires heap_policy_t::template keys_on_distance_for<T>; };
+}
+
+#endif // !QUIVER_HEAPS_CONCEPTS_HPP_INCLUDED
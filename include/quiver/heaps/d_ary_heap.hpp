@@ -0,0 +1,288 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_HEAPS_D_ARY_HEAP_HPP_INCLUDED
+#define QUIVER_HEAPS_D_ARY_HEAP_HPP_INCLUDED
+
+#include <quiver/heaps/concepts.hpp>
+#include <functional>
+#include <algorithm>
+#include <vector>
+#include <cassert>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+#include <cstddef>
+
+namespace quiver
+{
+	// An implicit heap in which every node has up to arity children. The children of a node are
+	// adjacent in the container, so sift_down compares them within one or two cache lines and the
+	// tree is only log_arity(n) levels deep. sift_up and sift_down move a hole instead of swapping.
+	template<typename T, std::size_t arity = 4, typename comparator_t = std::less<>, typename container_t = std::vector<T>, typename position_tracker_t = null_position_tracker>
+	class d_ary_heap
+	{
+		static_assert(arity >= 2, "a d-ary heap needs at least two children per node");
+
+	public:
+		using value_type = T;
+		using comparator_type = comparator_t;
+		using container_type = container_t;
+		using position_tracker_type = position_tracker_t;
+		// the index of a value in the container
+		using handle_type = std::size_t;
+		static constexpr handle_type null_handle = ~handle_type{};
+
+	private:
+		container_type m_container;
+		comparator_type m_comparator;
+		[[no_unique_address]] position_tracker_type m_position_tracker;
+
+		static constexpr std::size_t up(std::size_t index) noexcept		{ return (index - 1) / arity; }
+		static constexpr std::size_t down(std::size_t index) noexcept	{ return arity * index + 1; }
+
+		void track(std::size_t index)
+		{
+			m_position_tracker(std::as_const(m_container[index]), index);
+		}
+
+		std::size_t sift_up(std::size_t index)
+		{
+			assert(index < m_container.size());
+			if(index == 0 || !m_comparator(m_container[index], m_container[up(index)])) {
+				track(index);
+				return index;
+			}
+			value_type value(std::move(m_container[index]));
+			do {
+				const std::size_t parent = up(index);
+				m_container[index] = std::move(m_container[parent]);
+				track(index);
+				index = parent;
+			} while(index != 0 && m_comparator(value, m_container[up(index)]));
+			m_container[index] = std::move(value);
+			track(index);
+			return index;
+		}
+		std::size_t min_child(std::size_t first, std::size_t size) const
+		{
+			const std::size_t last = std::min(first + arity, size);
+			std::size_t result = first;
+			for(std::size_t child = first + 1; child < last; ++child)
+				if(m_comparator(m_container[child], m_container[result]))
+					result = child;
+			return result;
+		}
+		std::size_t sift_down(std::size_t index)
+		{
+			assert(index < m_container.size());
+			const std::size_t size = m_container.size();
+			std::size_t first = down(index);
+			if(first >= size || !m_comparator(m_container[min_child(first, size)], m_container[index])) {
+				track(index);
+				return index;
+			}
+			value_type value(std::move(m_container[index]));
+			for(; first < size; first = down(index)) {
+				const std::size_t child = min_child(first, size);
+				if(!m_comparator(m_container[child], value))
+					break;
+				m_container[index] = std::move(m_container[child]);
+				track(index);
+				index = child;
+			}
+			m_container[index] = std::move(value);
+			track(index);
+			return index;
+		}
+
+		bool is_heap() const
+		{
+			for(std::size_t i = 1; i < m_container.size(); ++i)
+				if(m_comparator(m_container[i], m_container[up(i)]))
+					return false;
+			return true;
+		}
+		void make_heap()
+		{
+			for(std::size_t i = (size() + arity - 2) / arity; i--;)
+				sift_down(i);
+			if constexpr(!std::is_same_v<position_tracker_type, null_position_tracker>)
+				for(std::size_t i = (size() + arity - 2) / arity; i < size(); ++i) // the leaves may not have been touched by sift_down
+					track(i);
+			assert(is_heap());
+		}
+
+	public:
+		d_ary_heap()
+		{
+		}
+		explicit d_ary_heap(comparator_t comparator)
+		: m_comparator(std::move(comparator))
+		{
+		}
+		d_ary_heap(comparator_t comparator, position_tracker_t position_tracker)
+		: m_comparator(std::move(comparator)), m_position_tracker(std::move(position_tracker))
+		{
+		}
+
+		void reserve(std::size_t capacity)
+		{
+			m_container.reserve(capacity);
+		}
+		std::size_t capacity() const noexcept
+		{
+			return m_container.capacity();
+		}
+
+		std::size_t size() const noexcept
+		{
+			return m_container.size();
+		}
+		bool empty() const noexcept
+		{
+			return size() == 0;
+		}
+		void clear()
+		{
+			m_container.clear();
+		}
+
+		void merge(d_ary_heap const& rhs)
+		{
+			reserve(size() + rhs.size());
+			m_container.insert(m_container.end(), rhs.m_container.begin(), rhs.m_container.end());
+			make_heap();
+		}
+		// a.k.a. 'meld'
+		void merge(d_ary_heap&& rhs)
+		{
+			if(capacity() < rhs.capacity()) {
+				using std::swap;
+				swap(m_container, rhs.m_container);
+			}
+			reserve(size() + rhs.size());
+			m_container.insert(m_container.end(), std::make_move_iterator(rhs.m_container.begin()), std::make_move_iterator(rhs.m_container.end()));
+			make_heap();
+		}
+
+		value_type const& get(std::size_t index) const noexcept
+		{
+			assert(index < m_container.size());
+			return m_container[index];
+		}
+
+		// a.k.a. 'find_min'
+		value_type const& top() const noexcept
+		{
+			assert(!empty());
+			return m_container.front();
+		}
+		// a.k.a. 'insert' or 'emplace'
+		template<typename... args_t>
+		std::size_t push(args_t&&... args)
+		{
+			m_container.emplace_back(std::forward<args_t>(args)...);
+			return sift_up(m_container.size() - 1);
+		}
+		void erase(std::size_t index)
+		{
+			assert(index < m_container.size());
+			value_type replacement(std::move(m_container.back()));
+			m_container.pop_back();
+			if(index != m_container.size())
+				update(index, std::move(replacement));
+		}
+		// a.k.a. 'remove_min'
+		void pop()
+		{
+			assert(!empty());
+			if(size() > 1) {
+				m_container.front() = std::move(m_container.back());
+				m_container.pop_back();
+				sift_down(0);
+			} else {
+				m_container.pop_back();
+			}
+		}
+		// a.k.a. 'extract_min'
+		value_type extract_top()
+		{
+			assert(!empty());
+			value_type result(std::move(m_container.front()));
+			pop();
+			return result;
+		}
+		// a.k.a. 'replace_min'
+		std::size_t exchange_top(value_type replacement)
+		{
+			assert(!empty());
+			m_container.front() = std::move(replacement);
+			return sift_down(0);
+		}
+
+		std::size_t update(std::size_t index, value_type replacement)
+		{
+			assert(index < m_container.size());
+			const bool cmp = m_comparator(m_container[index], replacement);
+			m_container[index] = std::move(replacement);
+			if(cmp)
+				return sift_down(index);
+			else
+				return sift_up(index);
+		}
+		// move down in the heap
+		std::size_t increase(std::size_t index, value_type replacement)
+		{
+			assert(index < m_container.size());
+			assert(!m_comparator(replacement, m_container[index]));
+			m_container[index] = std::move(replacement);
+			return sift_down(index);
+		}
+		// a.k.a. 'decrease_key'; move up in the heap
+		std::size_t decrease(std::size_t index, value_type replacement)
+		{
+			assert(index < m_container.size());
+			assert(!m_comparator(m_container[index], replacement));
+			m_container[index] = std::move(replacement);
+			return sift_up(index);
+		}
+
+		comparator_type const& comparator() const noexcept
+		{
+			return m_comparator;
+		}
+
+		void swap(d_ary_heap& rhs) noexcept
+		{
+			using std::swap;
+			swap(m_comparator, rhs.m_comparator);
+			swap(m_container, rhs.m_container);
+			swap(m_position_tracker, rhs.m_position_tracker);
+		}
+	};
+
+	template<typename T, std::size_t arity, typename comparator_t, typename container_t, typename position_tracker_t>
+	void swap(d_ary_heap<T, arity, comparator_t, container_t, position_tracker_t>& lhs, d_ary_heap<T, arity, comparator_t, container_t, position_tracker_t>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+
+	template<std::size_t arity>
+	struct d_ary_heap_policy
+	{
+		template<typename T, typename position_tracker_t = null_position_tracker>
+		using templ = d_ary_heap<T, arity, std::less<>, std::vector<T>, position_tracker_t>;
+	};
+
+	template<typename T, typename container_t = std::vector<T>>
+	using quaternary_heap = d_ary_heap<T, 4, std::less<>, container_t>;
+	template<typename T, typename container_t = std::vector<T>>
+	using octonary_heap = d_ary_heap<T, 8, std::less<>, container_t>;
+}
+
+#endif // !QUIVER_HEAPS_D_ARY_HEAP_HPP_INCLUDED
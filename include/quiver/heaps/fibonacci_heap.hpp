@@ -0,0 +1,295 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_HEAPS_FIBONACCI_HEAP_HPP_INCLUDED
+#define QUIVER_HEAPS_FIBONACCI_HEAP_HPP_INCLUDED
+
+#include <quiver/heaps/concepts.hpp>
+#include <quiver/heaps/node_pool.hpp>
+#include <functional>
+#include <vector>
+#include <cassert>
+#include <utility>
+#include <cstddef>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// outside of the heap so that handles don't depend on the comparator or the position tracker
+		template<typename T>
+		struct fibonacci_heap_node
+		{
+			T value;
+			fibonacci_heap_node* parent = nullptr;
+			fibonacci_heap_node* child = nullptr;
+			fibonacci_heap_node* left = nullptr;
+			fibonacci_heap_node* right = nullptr;
+			std::size_t degree = 0;
+			bool marked = false;
+
+			template<typename... args_t>
+			fibonacci_heap_node(std::in_place_t, args_t&&... args)
+			: value(std::forward<args_t>(args)...)
+			{
+			}
+		};
+	}
+
+	// A forest of heap ordered trees whose roots, like the children of every node, form a circular
+	// doubly linked list. push and decrease are O(1) amortized, pop is O(log n) amortized.
+	template<typename T, typename comparator_t = std::less<>, typename position_tracker_t = null_position_tracker>
+	class fibonacci_heap
+	{
+		using node = detail::fibonacci_heap_node<T>;
+
+	public:
+		using value_type = T;
+		using comparator_type = comparator_t;
+		using position_tracker_type = position_tracker_t;
+		// the node of a value; stays valid until the value leaves the heap
+		using handle_type = node*;
+		static constexpr handle_type null_handle = nullptr;
+
+	private:
+		detail::node_pool<node> m_nodes;
+		node* m_min = nullptr;
+		std::size_t m_size = 0;
+		// scratch space of consolidate, kept to avoid allocations in pop
+		std::vector<node*> m_roots;
+		std::vector<node*> m_by_degree;
+		comparator_type m_comparator;
+		[[no_unique_address]] position_tracker_type m_position_tracker;
+
+		static void unlink(node* n) noexcept
+		{
+			n->left->right = n->right;
+			n->right->left = n->left;
+			n->left = n->right = n;
+		}
+		// inserts the single node n into the list of position
+		static void splice(node* position, node* n) noexcept
+		{
+			n->right = position->right;
+			n->left = position;
+			position->right->left = n;
+			position->right = n;
+		}
+		void add_root(node* n)
+		{
+			n->parent = nullptr;
+			n->marked = false;
+			if(!m_min) {
+				n->left = n->right = n;
+				m_min = n;
+			} else {
+				splice(m_min, n);
+				if(m_comparator(n->value, m_min->value))
+					m_min = n;
+			}
+		}
+		// makes the root child a child of the root parent
+		void link(node* child, node* parent)
+		{
+			unlink(child);
+			child->parent = parent;
+			child->marked = false;
+			if(parent->child)
+				splice(parent->child, child);
+			else
+				parent->child = child;
+			++parent->degree;
+		}
+		void consolidate()
+		{
+			m_roots.clear();
+			node* n = m_min;
+			do {
+				m_roots.push_back(n);
+				n = n->right;
+			} while(n != m_min);
+
+			m_by_degree.clear();
+			for(node* root : m_roots) {
+				std::size_t degree = root->degree;
+				for(;; ++degree) {
+					if(degree >= m_by_degree.size())
+						m_by_degree.resize(degree + 1, nullptr);
+					node* other = m_by_degree[degree];
+					if(!other)
+						break;
+					if(m_comparator(other->value, root->value))
+						std::swap(root, other);
+					link(other, root);
+					m_by_degree[degree] = nullptr;
+				}
+				m_by_degree[degree] = root;
+			}
+
+			m_min = nullptr;
+			for(node* root : m_by_degree)
+				if(root && (!m_min || m_comparator(root->value, m_min->value)))
+					m_min = root;
+		}
+		void cut(node* n, node* parent)
+		{
+			if(n->right == n)
+				parent->child = nullptr;
+			else if(parent->child == n)
+				parent->child = n->right;
+			unlink(n);
+			--parent->degree;
+			add_root(n);
+		}
+		void cascading_cut(node* n)
+		{
+			for(node* parent = n->parent; parent; parent = n->parent) {
+				if(!n->marked) {
+					n->marked = true;
+					break;
+				}
+				cut(n, parent);
+				n = parent;
+			}
+		}
+
+	public:
+		fibonacci_heap()
+		{
+		}
+		explicit fibonacci_heap(comparator_t comparator)
+		: m_comparator(std::move(comparator))
+		{
+		}
+		fibonacci_heap(comparator_t comparator, position_tracker_t position_tracker)
+		: m_comparator(std::move(comparator)), m_position_tracker(std::move(position_tracker))
+		{
+		}
+		fibonacci_heap(fibonacci_heap const&) = delete;
+		fibonacci_heap(fibonacci_heap&& other) noexcept
+		{
+			swap(other);
+		}
+		fibonacci_heap& operator=(fibonacci_heap const&) = delete;
+		fibonacci_heap& operator=(fibonacci_heap&& other) noexcept
+		{
+			swap(other);
+			return *this;
+		}
+
+		std::size_t size() const noexcept
+		{
+			return m_size;
+		}
+		bool empty() const noexcept
+		{
+			return size() == 0;
+		}
+		void clear()
+		{
+			m_nodes.clear();
+			m_min = nullptr;
+			m_size = 0;
+		}
+
+		value_type const& get(handle_type handle) const noexcept
+		{
+			assert(handle);
+			return handle->value;
+		}
+
+		// a.k.a. 'find_min'
+		value_type const& top() const noexcept
+		{
+			assert(!empty());
+			return m_min->value;
+		}
+		// a.k.a. 'insert' or 'emplace'
+		template<typename... args_t>
+		handle_type push(args_t&&... args)
+		{
+			node* n = m_nodes.acquire(std::in_place, std::forward<args_t>(args)...);
+			m_position_tracker(std::as_const(n->value), static_cast<handle_type>(n));
+			add_root(n);
+			++m_size;
+			return n;
+		}
+		// a.k.a. 'remove_min'
+		void pop()
+		{
+			assert(!empty());
+			node* old_min = m_min;
+			node* child = old_min->child;
+			for(std::size_t i = old_min->degree; i--;) {
+				node* next = child->right;
+				unlink(child);
+				add_root(child);
+				child = next;
+			}
+			m_min = old_min->right != old_min ? old_min->right : nullptr;
+			unlink(old_min);
+			m_nodes.release(old_min);
+			--m_size;
+			if(m_min)
+				consolidate();
+		}
+		// a.k.a. 'extract_min'
+		value_type extract_top()
+		{
+			assert(!empty());
+			value_type result(std::move(m_min->value));
+			pop();
+			return result;
+		}
+
+		// a.k.a. 'decrease_key'
+		void decrease(handle_type handle, value_type replacement)
+		{
+			assert(handle);
+			assert(!m_comparator(handle->value, replacement));
+			handle->value = std::move(replacement);
+			node* parent = handle->parent;
+			if(parent && m_comparator(handle->value, parent->value)) {
+				cut(handle, parent);
+				cascading_cut(parent);
+			}
+			if(m_comparator(handle->value, m_min->value))
+				m_min = handle;
+		}
+
+		comparator_type const& comparator() const noexcept
+		{
+			return m_comparator;
+		}
+
+		void swap(fibonacci_heap& rhs) noexcept
+		{
+			using std::swap;
+			m_nodes.swap(rhs.m_nodes);
+			swap(m_min, rhs.m_min);
+			swap(m_size, rhs.m_size);
+			swap(m_roots, rhs.m_roots);
+			swap(m_by_degree, rhs.m_by_degree);
+			swap(m_comparator, rhs.m_comparator);
+			swap(m_position_tracker, rhs.m_position_tracker);
+		}
+	};
+
+	template<typename T, typename comparator_t, typename position_tracker_t>
+	void swap(fibonacci_heap<T, comparator_t, position_tracker_t>& lhs, fibonacci_heap<T, comparator_t, position_tracker_t>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+
+	struct fibonacci_heap_policy
+	{
+		template<typename T, typename position_tracker_t = null_position_tracker>
+		using templ = fibonacci_heap<T, std::less<>, position_tracker_t>;
+	};
+}
+
+#endif // !QUIVER_HEAPS_FIBONACCI_HEAP_HPP_INCLUDED
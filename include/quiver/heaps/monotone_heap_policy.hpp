@@ -0,0 +1,55 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_HEAPS_MONOTONE_HEAP_POLICY_HPP_INCLUDED
+#define QUIVER_HEAPS_MONOTONE_HEAP_POLICY_HPP_INCLUDED
+
+#include <quiver/heaps/concepts.hpp>
+#include <quiver/heaps/binary_heap.hpp>
+#include <quiver/heaps/radix_heap.hpp>
+#include <quiver/heaps/bucket_queue.hpp>
+#include <functional>
+#include <type_traits>
+#include <concepts>
+#include <limits>
+#include <vector>
+
+namespace quiver
+{
+	namespace detail
+	{
+		template<typename T, typename position_tracker_t>
+		struct select_monotone_heap
+		{
+			using type = binary_heap<T, std::less<>, std::vector<T>, position_tracker_t>;
+			static constexpr bool keys_on_distance = false;
+		};
+		template<typename T>
+			requires std::unsigned_integral<std::remove_cvref_t<decltype(std::declval<T const&>().distance)>>
+		struct select_monotone_heap<T, null_position_tracker>
+		{
+			using key_t = std::remove_cvref_t<decltype(std::declval<T const&>().distance)>;
+			using type = std::conditional_t<(std::numeric_limits<key_t>::digits <= 16), bucket_queue_policy::templ<T>, radix_heap_policy::templ<T>>;
+			static constexpr bool keys_on_distance = true;
+		};
+	}
+
+	// Chooses the queue from the type of the member distance: unsigned integers of at most 16 bits, whose edges
+	// can't be heavier than 65535, get a bucket_queue, wider ones a radix_heap. Any other distance, as well as a
+	// position_tracker_t, which only dijkstra_strategy_t::decrease_key passes, falls back to a binary_heap.
+	// Only the binary_heap orders by operator<, so astar accepts this policy just for other distances.
+	struct monotone_heap_policy
+	{
+		template<typename T, typename position_tracker_t = null_position_tracker>
+		using templ = typename detail::select_monotone_heap<T, position_tracker_t>::type;
+
+		template<typename T, typename position_tracker_t = null_position_tracker>
+		static constexpr bool keys_on_distance_for = detail::select_monotone_heap<T, position_tracker_t>::keys_on_distance;
+	};
+}
+
+#endif // !QUIVER_HEAPS_MONOTONE_HEAP_POLICY_HPP_INCLUDED
@@ -0,0 +1,55 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_HEAPS_NODE_POOL_HPP_INCLUDED
+#define QUIVER_HEAPS_NODE_POOL_HPP_INCLUDED
+
+#include <deque>
+#include <vector>
+#include <utility>
+
+namespace quiver::detail
+{
+	// Storage for the nodes of the pointer based heaps. Nodes keep their address until the pool
+	// is cleared and released nodes are recycled, so a heap allocates only when it grows.
+	template<typename node_t>
+	class node_pool
+	{
+		std::deque<node_t> m_nodes;
+		std::vector<node_t*> m_free;
+
+	public:
+		template<typename... args_t>
+		node_t* acquire(args_t&&... args)
+		{
+			if(m_free.empty())
+				return &m_nodes.emplace_back(std::forward<args_t>(args)...);
+			node_t* node = m_free.back();
+			m_free.pop_back();
+			*node = node_t(std::forward<args_t>(args)...);
+			return node;
+		}
+		void release(node_t* node)
+		{
+			m_free.push_back(node);
+		}
+		void clear() noexcept
+		{
+			m_nodes.clear();
+			m_free.clear();
+		}
+
+		void swap(node_pool& rhs) noexcept
+		{
+			using std::swap;
+			swap(m_nodes, rhs.m_nodes);
+			swap(m_free, rhs.m_free);
+		}
+	};
+}
+
+#endif // !QUIVER_HEAPS_NODE_POOL_HPP_INCLUDED
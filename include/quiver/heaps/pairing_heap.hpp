@@ -0,0 +1,239 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_HEAPS_PAIRING_HEAP_HPP_INCLUDED
+#define QUIVER_HEAPS_PAIRING_HEAP_HPP_INCLUDED
+
+#include <quiver/heaps/concepts.hpp>
+#include <quiver/heaps/node_pool.hpp>
+#include <functional>
+#include <cassert>
+#include <utility>
+#include <cstddef>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// outside of the heap so that handles don't depend on the comparator or the position tracker
+		template<typename T>
+		struct pairing_heap_node
+		{
+			T value;
+			pairing_heap_node* child = nullptr;
+			pairing_heap_node* next = nullptr;
+			pairing_heap_node* prev = nullptr;
+
+			template<typename... args_t>
+			pairing_heap_node(std::in_place_t, args_t&&... args)
+			: value(std::forward<args_t>(args)...)
+			{
+			}
+		};
+	}
+
+	// A multiway tree in which every node is a child list linked through next and prev. prev points
+	// to the left sibling, or to the parent for the leftmost child. push and decrease are O(1),
+	// pop is O(log n) amortized by the two-pass pairing of the children of the root.
+	template<typename T, typename comparator_t = std::less<>, typename position_tracker_t = null_position_tracker>
+	class pairing_heap
+	{
+		using node = detail::pairing_heap_node<T>;
+
+	public:
+		using value_type = T;
+		using comparator_type = comparator_t;
+		using position_tracker_type = position_tracker_t;
+		// the node of a value; stays valid until the value leaves the heap
+		using handle_type = node*;
+		static constexpr handle_type null_handle = nullptr;
+
+	private:
+		detail::node_pool<node> m_nodes;
+		node* m_root = nullptr;
+		std::size_t m_size = 0;
+		comparator_type m_comparator;
+		[[no_unique_address]] position_tracker_type m_position_tracker;
+
+		// lhs and rhs are roots without siblings
+		node* link(node* lhs, node* rhs)
+		{
+			if(m_comparator(rhs->value, lhs->value))
+				std::swap(lhs, rhs);
+			rhs->prev = lhs;
+			rhs->next = lhs->child;
+			if(lhs->child)
+				lhs->child->prev = rhs;
+			lhs->child = rhs;
+			return lhs;
+		}
+		void detach(node* n)
+		{
+			assert(n->prev);
+			if(n->prev->child == n)
+				n->prev->child = n->next;
+			else
+				n->prev->next = n->next;
+			if(n->next)
+				n->next->prev = n->prev;
+			n->next = n->prev = nullptr;
+		}
+		node* pair_up(node* first)
+		{
+			if(!first)
+				return nullptr;
+			// first pass: link pairs from left to right, stacking the results through next
+			node* pairs = nullptr;
+			while(first) {
+				node* lhs = first;
+				node* rhs = lhs->next;
+				lhs->next = lhs->prev = nullptr;
+				if(!rhs) {
+					lhs->next = pairs;
+					pairs = lhs;
+					break;
+				}
+				first = rhs->next;
+				rhs->next = rhs->prev = nullptr;
+				node* linked = link(lhs, rhs);
+				linked->next = pairs;
+				pairs = linked;
+			}
+			// second pass: link the pairs from right to left
+			node* result = pairs;
+			pairs = pairs->next;
+			result->next = nullptr;
+			while(pairs) {
+				node* pair = pairs;
+				pairs = pairs->next;
+				pair->next = nullptr;
+				result = link(result, pair);
+			}
+			return result;
+		}
+
+	public:
+		pairing_heap()
+		{
+		}
+		explicit pairing_heap(comparator_t comparator)
+		: m_comparator(std::move(comparator))
+		{
+		}
+		pairing_heap(comparator_t comparator, position_tracker_t position_tracker)
+		: m_comparator(std::move(comparator)), m_position_tracker(std::move(position_tracker))
+		{
+		}
+		pairing_heap(pairing_heap const&) = delete;
+		pairing_heap(pairing_heap&& other) noexcept
+		{
+			swap(other);
+		}
+		pairing_heap& operator=(pairing_heap const&) = delete;
+		pairing_heap& operator=(pairing_heap&& other) noexcept
+		{
+			swap(other);
+			return *this;
+		}
+
+		std::size_t size() const noexcept
+		{
+			return m_size;
+		}
+		bool empty() const noexcept
+		{
+			return size() == 0;
+		}
+		void clear()
+		{
+			m_nodes.clear();
+			m_root = nullptr;
+			m_size = 0;
+		}
+
+		value_type const& get(handle_type handle) const noexcept
+		{
+			assert(handle);
+			return handle->value;
+		}
+
+		// a.k.a. 'find_min'
+		value_type const& top() const noexcept
+		{
+			assert(!empty());
+			return m_root->value;
+		}
+		// a.k.a. 'insert' or 'emplace'
+		template<typename... args_t>
+		handle_type push(args_t&&... args)
+		{
+			node* n = m_nodes.acquire(std::in_place, std::forward<args_t>(args)...);
+			m_position_tracker(std::as_const(n->value), static_cast<handle_type>(n));
+			m_root = m_root ? link(m_root, n) : n;
+			++m_size;
+			return n;
+		}
+		// a.k.a. 'remove_min'
+		void pop()
+		{
+			assert(!empty());
+			node* old_root = m_root;
+			m_root = pair_up(old_root->child);
+			m_nodes.release(old_root);
+			--m_size;
+		}
+		// a.k.a. 'extract_min'
+		value_type extract_top()
+		{
+			assert(!empty());
+			value_type result(std::move(m_root->value));
+			pop();
+			return result;
+		}
+
+		// a.k.a. 'decrease_key'
+		void decrease(handle_type handle, value_type replacement)
+		{
+			assert(handle);
+			assert(!m_comparator(handle->value, replacement));
+			handle->value = std::move(replacement);
+			if(handle != m_root) {
+				detach(handle);
+				m_root = link(m_root, handle);
+			}
+		}
+
+		comparator_type const& comparator() const noexcept
+		{
+			return m_comparator;
+		}
+
+		void swap(pairing_heap& rhs) noexcept
+		{
+			using std::swap;
+			m_nodes.swap(rhs.m_nodes);
+			swap(m_root, rhs.m_root);
+			swap(m_size, rhs.m_size);
+			swap(m_comparator, rhs.m_comparator);
+			swap(m_position_tracker, rhs.m_position_tracker);
+		}
+	};
+
+	template<typename T, typename comparator_t, typename position_tracker_t>
+	void swap(pairing_heap<T, comparator_t, position_tracker_t>& lhs, pairing_heap<T, comparator_t, position_tracker_t>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+
+	struct pairing_heap_policy
+	{
+		template<typename T, typename position_tracker_t = null_position_tracker>
+		using templ = pairing_heap<T, std::less<>, position_tracker_t>;
+	};
+}
+
+#endif // !QUIVER_HEAPS_PAIRING_HEAP_HPP_INCLUDED
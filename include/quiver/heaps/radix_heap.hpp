@@ -0,0 +1,169 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_HEAPS_RADIX_HEAP_HPP_INCLUDED
+#define QUIVER_HEAPS_RADIX_HEAP_HPP_INCLUDED
+
+#include <quiver/heaps/concepts.hpp>
+#include <functional>
+#include <type_traits>
+#include <concepts>
+#include <algorithm>
+#include <limits>
+#include <array>
+#include <vector>
+#include <bit>
+#include <cassert>
+#include <utility>
+#include <cstddef>
+
+namespace quiver
+{
+	// A monotone min heap for unsigned integer keys, obtained by invoking projection on the values.
+	// Keys must never be less than the key of the last value returned by top, which is the case in
+	// Dijkstra's algorithm. Bucket i holds the keys which first differ from that key in bit i - 1,
+	// so every value is moved at most once per bit of the key type until it is popped.
+	template<typename T, typename projection_t = std::identity>
+	class radix_heap
+	{
+	public:
+		using value_type = T;
+		using projection_type = projection_t;
+		using key_type = std::remove_cvref_t<std::invoke_result_t<projection_t const&, T const&>>;
+		static_assert(std::unsigned_integral<key_type>, "radix heaps require unsigned integral keys");
+
+	private:
+		// top has to redistribute the buckets, which is not observable from outside
+		mutable std::array<std::vector<value_type>, std::numeric_limits<key_type>::digits + 1> m_buckets;
+		mutable key_type m_last = 0;
+		std::size_t m_size = 0;
+		[[no_unique_address]] projection_type m_projection;
+
+		key_type key(value_type const& value) const
+		{
+			return m_projection(value);
+		}
+		std::size_t bucket(key_type key) const noexcept
+		{
+			return key == m_last ? 0 : static_cast<std::size_t>(std::bit_width(static_cast<key_type>(key ^ m_last)));
+		}
+		void refill() const
+		{
+			assert(m_size != 0);
+			if(!m_buckets.front().empty())
+				return;
+			std::size_t i = 1;
+			while(m_buckets[i].empty())
+				++i;
+			std::vector<value_type>& source = m_buckets[i];
+			m_last = key(*std::min_element(source.begin(), source.end(), [this](value_type const& lhs, value_type const& rhs) {
+				return key(lhs) < key(rhs);
+			}));
+			for(value_type& value : source)
+				m_buckets[bucket(key(value))].push_back(std::move(value));
+			source.clear();
+		}
+
+	public:
+		radix_heap()
+		{
+		}
+		explicit radix_heap(projection_t projection)
+		: m_projection(std::move(projection))
+		{
+		}
+
+		std::size_t size() const noexcept
+		{
+			return m_size;
+		}
+		bool empty() const noexcept
+		{
+			return size() == 0;
+		}
+		// also resets the lower bound of the keys
+		void clear()
+		{
+			for(auto& bucket : m_buckets)
+				bucket.clear();
+			m_last = 0;
+			m_size = 0;
+		}
+
+		// a.k.a. 'find_min'
+		value_type const& top() const
+		{
+			assert(!empty());
+			refill();
+			return m_buckets.front().back();
+		}
+		// a.k.a. 'insert' or 'emplace'
+		template<typename... args_t>
+		void push(args_t&&... args)
+		{
+			value_type value(std::forward<args_t>(args)...);
+			const key_type value_key = key(value);
+			assert(value_key >= m_last);
+			m_buckets[bucket(value_key)].push_back(std::move(value));
+			++m_size;
+		}
+		// a.k.a. 'remove_min'
+		void pop()
+		{
+			assert(!empty());
+			refill();
+			m_buckets.front().pop_back();
+			--m_size;
+		}
+		// a.k.a. 'extract_min'
+		value_type extract_top()
+		{
+			assert(!empty());
+			refill();
+			value_type result(std::move(m_buckets.front().back()));
+			m_buckets.front().pop_back();
+			--m_size;
+			return result;
+		}
+
+		void swap(radix_heap& rhs) noexcept
+		{
+			using std::swap;
+			swap(m_buckets, rhs.m_buckets);
+			swap(m_last, rhs.m_last);
+			swap(m_size, rhs.m_size);
+			swap(m_projection, rhs.m_projection);
+		}
+	};
+
+	template<typename T, typename projection_t>
+	void swap(radix_heap<T, projection_t>& lhs, radix_heap<T, projection_t>& rhs) noexcept
+	{
+		lhs.swap(rhs);
+	}
+
+	// for values with an unsigned integral member distance, such as the queue entries of dijkstra;
+	// radix heaps are not addressable and thus only suit dijkstra_strategy_t::always_insert
+	struct radix_heap_policy
+	{
+		static constexpr bool keys_on_distance = true;
+
+		struct projection
+		{
+			template<typename T>
+			constexpr auto operator()(T const& value) const noexcept
+			{
+				return value.distance;
+			}
+		};
+
+		template<typename T, typename position_tracker_t = null_position_tracker>
+		using templ = radix_heap<T, projection>;
+	};
+}
+
+#endif // !QUIVER_HEAPS_RADIX_HEAP_HPP_INCLUDED
@@ -13,18 +13,25 @@
 #include <vector>
 #include <algorithm>
 #include <type_traits>
+#include <utility>
 
 namespace quiver
 {
+	// the graph type returned by graph_t::strip_edges; for immutable graphs such as csr_graph, this is a mutable adjacency_list
 	template<typename graph_t>
-	std::enable_if_t<is_weighted_v<graph_t>, graph_t> kruskal(graph_t const& graph)
+	using stripped_graph_t = std::remove_cvref_t<decltype(std::declval<graph_t const&>().strip_edges())>;
+
+	template<typename graph_t>
+	std::enable_if_t<is_weighted_v<graph_t>, stripped_graph_t<graph_t>> kruskal(graph_t const& graph)
 	{
 		static_assert(is_undirected_v<graph_t>, "kruskal operates on undirected graphs");
 
-		disjoint_set<> cc(graph.V.size());
+		using index_t = typename graph_t::vertex_index_type;
+
+		disjoint_set<path_splitting, index_t> cc(graph.V.size());
 		struct edge_t
 		{
-			vertex_index_t from, to;
+			index_t from, to;
 			typename graph_t::out_edge_t const* ptr;
 
 			constexpr edge_t(decltype(from) from, decltype(to) to, decltype(ptr) ptr)
@@ -46,7 +53,7 @@ namespace quiver
 		}
 		std::sort(edges.begin(), edges.end(), [](edge_t const& lhs, edge_t const& rhs){ return lhs.ptr->weight < rhs.ptr->weight; });
 
-		graph_t mst = graph.strip_edges();
+		stripped_graph_t<graph_t> mst = graph.strip_edges();
 		for(edge_t const& e : edges)
 		{
 			if(cc.unite(e.from, e.to))
@@ -55,12 +62,12 @@ namespace quiver
 		return mst;
 	}
 	template<typename graph_t>
-	std::enable_if_t<!is_weighted_v<graph_t>, graph_t> kruskal(graph_t const& graph)
+	std::enable_if_t<!is_weighted_v<graph_t>, stripped_graph_t<graph_t>> kruskal(graph_t const& graph)
 	{
 		static_assert(is_undirected_v<graph_t>, "kruskal operates on undirected graphs");
 
-		graph_t mst = graph.strip_edges();
-		disjoint_set<> cc(graph.V.size());
+		stripped_graph_t<graph_t> mst = graph.strip_edges();
+		disjoint_set<path_splitting, typename graph_t::vertex_index_type> cc(graph.V.size());
 		vertex_index_t vert_index = 0;
 		for(auto const& vert : graph.V) {
 			for(auto const& out_edge : vert.out_edges)
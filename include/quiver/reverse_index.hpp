@@ -0,0 +1,86 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_REVERSE_INDEX_HPP_INCLUDED
+#define QUIVER_REVERSE_INDEX_HPP_INCLUDED
+
+#include <quiver/typedefs.hpp>
+#include <vector>
+#include <span>
+#include <cassert>
+#include <cstddef>
+
+namespace quiver
+{
+	// The in-edges of every vertex of a graph in compressed sparse row form. For each vertex, the sources of
+	// its in-edges and the out_edges they correspond to are stored in separate arrays, such that searches
+	// which only need the sources don't have to load the pointers. The in-edges of a vertex are ordered by
+	// their source. Unlike transpose, it is a view: it has to be rebuilt when the edges of the graph change.
+	template<typename graph_t>
+	class reverse_index
+	{
+	public:
+		using vertex_index_type = typename graph_t::vertex_index_type;
+		using out_edge_t = typename graph_t::out_edge_t;
+
+	private:
+		std::vector<std::size_t> m_offsets;
+		std::vector<vertex_index_type> m_sources;
+		std::vector<out_edge_t const*> m_edges;
+
+	public:
+		explicit reverse_index(graph_t const& graph)
+		: m_offsets(graph.V.size() + 1, 0)
+		{
+			for(vertex_index_t from = 0; from < graph.V.size(); ++from)
+				for(out_edge_t const& edge : graph.V[from].out_edges)
+					++m_offsets[edge.to + 1];
+			for(vertex_index_t to = 0; to < graph.V.size(); ++to)
+				m_offsets[to + 1] += m_offsets[to];
+
+			m_sources.resize(m_offsets.back());
+			m_edges.resize(m_offsets.back());
+			std::vector<std::size_t> next(m_offsets.begin(), m_offsets.end() - 1);
+			for(vertex_index_t from = 0; from < graph.V.size(); ++from)
+				for(out_edge_t const& edge : graph.V[from].out_edges) {
+					const std::size_t slot = next[edge.to]++;
+					m_sources[slot] = static_cast<vertex_index_type>(from);
+					m_edges[slot] = &edge;
+				}
+		}
+
+		// the number of vertices
+		std::size_t size() const noexcept
+		{
+			return m_offsets.size() - 1;
+		}
+		// the number of out_edges of the graph
+		std::size_t edges() const noexcept
+		{
+			return m_sources.size();
+		}
+
+		std::size_t in_degree(vertex_index_t to) const noexcept
+		{
+			assert(to < size());
+			return m_offsets[to + 1] - m_offsets[to];
+		}
+		std::span<vertex_index_type const> sources(vertex_index_t to) const noexcept
+		{
+			assert(to < size());
+			return { m_sources.data() + m_offsets[to], m_sources.data() + m_offsets[to + 1] };
+		}
+		// in_edges(to)[i] is the out_edge from sources(to)[i] to to
+		std::span<out_edge_t const* const> in_edges(vertex_index_t to) const noexcept
+		{
+			assert(to < size());
+			return { m_edges.data() + m_offsets[to], m_edges.data() + m_offsets[to + 1] };
+		}
+	};
+}
+
+#endif // !QUIVER_REVERSE_INDEX_HPP_INCLUDED
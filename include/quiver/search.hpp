@@ -8,9 +8,20 @@
 #ifndef QUIVER_SEARCH_HPP_INCLUDED
 #define QUIVER_SEARCH_HPP_INCLUDED
 
+#include <quiver/search/all_pairs.hpp>
+#include <quiver/search/astar.hpp>
+#include <quiver/search/alt.hpp>
+#include <quiver/search/bellman_ford.hpp>
 #include <quiver/search/bfs.hpp>
+#include <quiver/search/bidirectional.hpp>
+#include <quiver/search/delta_stepping.hpp>
 #include <quiver/search/dfs.hpp>
+#include <quiver/search/direction_optimizing_bfs.hpp>
 #include <quiver/search/dijkstra.hpp>
+#include <quiver/search/k_shortest_paths.hpp>
+#include <quiver/search/multi_source_bfs.hpp>
+#include <quiver/search/parallel_bfs.hpp>
 #include <quiver/search/visitation_table.hpp>
+#include <quiver/search/workspace.hpp>
 
 #endif // !QUIVER_SEARCH_HPP_INCLUDED
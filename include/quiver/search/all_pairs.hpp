@@ -0,0 +1,165 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_ALL_PAIRS_HPP_INCLUDED
+#define QUIVER_SEARCH_ALL_PAIRS_HPP_INCLUDED
+
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/search/workspace.hpp>
+#include <quiver/exception.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <span>
+#include <cassert>
+#include <cstddef>
+
+namespace quiver
+{
+	namespace detail
+	{
+		template<typename graph_t, typename weight_invokable_t>
+		using weight_scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, typename graph_t::out_edge_t const>;
+
+		// relaxes the block [i_begin, i_end) x [j_begin, j_end) of the n x n matrix over the intermediate vertices
+		// [k_begin, k_end). The innermost loop runs over a contiguous row without branches, so that it vectorizes.
+		// Returns false without relaxing over k if the distance from k to itself is negative: k then lies on a
+		// negative cycle, around which every further relaxation over k would go once more, until it overflows.
+		template<typename scalar_t>
+		bool floyd_warshall_block(scalar_t* matrix, std::size_t n, std::size_t i_begin, std::size_t i_end, std::size_t j_begin, std::size_t j_end, std::size_t k_begin, std::size_t k_end) noexcept
+		{
+			for(std::size_t k = k_begin; k < k_end; ++k) {
+				scalar_t const* row_k = matrix + k * n;
+				if(row_k[k] < scalar_t(0))
+					return false;
+				for(std::size_t i = i_begin; i < i_end; ++i) {
+					scalar_t* row_i = matrix + i * n;
+					const scalar_t to_k = row_i[k];
+					if(to_k == inf<scalar_t>)
+						continue;
+					for(std::size_t j = j_begin; j < j_end; ++j) {
+						const scalar_t through_k = row_k[j] == inf<scalar_t> ? inf<scalar_t> : to_k + row_k[j];
+						row_i[j] = through_k < row_i[j] ? through_k : row_i[j];
+					}
+				}
+			}
+			return true;
+		}
+	}
+
+	// Writes the distance from every vertex to every vertex into distances, a row-major matrix of V x V
+	// scalars, or inf<scalar_t> if there is no path. Each row is a dijkstra_shortest_path from its vertex on
+	// a worker of pool, which keeps one search_workspace, so the searches allocate nothing once it has grown.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t) and may be invoked concurrently.
+	template<typename graph_t, typename weight_invokable_t>
+	void all_pairs_shortest_paths(graph_t& graph, std::span<detail::weight_scalar_t<graph_t, weight_invokable_t>> distances, thread_pool& pool, weight_invokable_t weight_invokable)
+	{
+		using scalar_t = detail::weight_scalar_t<graph_t, weight_invokable_t>;
+		using workspace_t = search_workspace<scalar_t, typename graph_t::vertex_index_type>;
+
+		const std::size_t n = graph.V.size();
+		assert(distances.size() == n * n);
+		std::vector<workspace_t> workspaces(pool.size());
+		const std::size_t grain = std::max<std::size_t>(1, n / (8 * pool.size()));
+		pool.parallel_for(n, grain, [&](std::size_t worker, std::size_t begin, std::size_t end) {
+			workspace_t& workspace = workspaces[worker];
+			for(vertex_index_t source = begin; source < end; ++source) {
+				dijkstra_shortest_path(graph, source, workspace, weight_invokable);
+				scalar_t* row = distances.data() + source * n;
+				for(vertex_index_t target = 0; target < n; ++target)
+					row[target] = workspace.reached(target) ? workspace.distance(target) : inf<scalar_t>;
+			}
+		});
+	}
+	template<typename graph_t>
+	void all_pairs_shortest_paths(graph_t& graph, std::span<detail::weight_scalar_t<graph_t, decltype(dijkstra_default_weight_invokable<graph_t>())>> distances, thread_pool& pool)
+	{
+		all_pairs_shortest_paths(graph, distances, pool, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t>
+	void all_pairs_shortest_paths(graph_t& graph, std::span<detail::weight_scalar_t<graph_t, decltype(dijkstra_default_weight_invokable<graph_t>())>> distances)
+	{
+		thread_pool pool;
+		all_pairs_shortest_paths(graph, distances, pool);
+	}
+
+	// The size of the square blocks floyd_warshall works on; three of them fit into the L1 cache for 4 byte scalars.
+	inline constexpr std::size_t floyd_warshall_block_size = 64;
+
+	// Writes the same matrix as all_pairs_shortest_paths, but by the Floyd-Warshall algorithm, which suits dense
+	// graphs and admits negative weights. The matrix is processed in blocks: for every diagonal block, that block is
+	// relaxed first, then the other blocks of its row and column, and then all the others, each step in parallel on
+	// pool. Throws negative_cycle if the graph contains one, which is noticed by the diagonal block that holds
+	// the greatest of its vertices, before any distance can overflow.
+	template<typename graph_t, typename weight_invokable_t>
+	void floyd_warshall(graph_t& graph, std::span<detail::weight_scalar_t<graph_t, weight_invokable_t>> distances, thread_pool& pool, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = detail::weight_scalar_t<graph_t, weight_invokable_t>;
+
+		const std::size_t n = graph.V.size();
+		assert(distances.size() == n * n);
+		scalar_t* matrix = distances.data();
+		std::fill(distances.begin(), distances.end(), inf<scalar_t>);
+		for(vertex_index_t from = 0; from < n; ++from) {
+			matrix[from * n + from] = scalar_t(0);
+			for(out_edge_t const& edge : graph.V[from].out_edges) {
+				scalar_t& distance = matrix[from * n + edge.to];
+				distance = std::min(distance, scalar_t(weight_invokable(from, edge)));
+			}
+		}
+
+		constexpr std::size_t size = floyd_warshall_block_size;
+		const std::size_t blocks = (n + size - 1) / size;
+		const auto relax = [&](std::size_t i, std::size_t j, std::size_t k) {
+			return detail::floyd_warshall_block(matrix, n, i * size, std::min(n, (i + 1) * size), j * size, std::min(n, (j + 1) * size), k * size, std::min(n, (k + 1) * size));
+		};
+		std::vector<std::pair<std::size_t, std::size_t>> tasks;
+		const auto run = [&](std::size_t k) {
+			pool.parallel_for(tasks.size(), 1, [&](std::size_t worker, std::size_t begin, std::size_t end) {
+				(void)worker; // -Wunused-parameter
+				for(std::size_t position = begin; position < end; ++position)
+					relax(tasks[position].first, tasks[position].second, k); // the diagonal block has checked k
+			});
+		};
+		for(std::size_t k = 0; k < blocks; ++k) {
+			if(!relax(k, k, k))
+				throw negative_cycle{ "floyd_warshall: graph contains a negative cycle" };
+
+			tasks.clear();
+			for(std::size_t other = 0; other < blocks; ++other)
+				if(other != k) {
+					tasks.emplace_back(k, other);
+					tasks.emplace_back(other, k);
+				}
+			run(k);
+
+			tasks.clear();
+			for(std::size_t i = 0; i < blocks; ++i)
+				for(std::size_t j = 0; j < blocks; ++j)
+					if(i != k && j != k)
+						tasks.emplace_back(i, j);
+			run(k);
+		}
+	}
+	template<typename graph_t>
+	void floyd_warshall(graph_t& graph, std::span<detail::weight_scalar_t<graph_t, decltype(dijkstra_default_weight_invokable<graph_t>())>> distances, thread_pool& pool)
+	{
+		floyd_warshall(graph, distances, pool, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t>
+	void floyd_warshall(graph_t& graph, std::span<detail::weight_scalar_t<graph_t, decltype(dijkstra_default_weight_invokable<graph_t>())>> distances)
+	{
+		thread_pool pool;
+		floyd_warshall(graph, distances, pool);
+	}
+}
+
+#endif // !QUIVER_SEARCH_ALL_PAIRS_HPP_INCLUDED
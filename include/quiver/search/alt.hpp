@@ -0,0 +1,355 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_ALT_HPP_INCLUDED
+#define QUIVER_SEARCH_ALT_HPP_INCLUDED
+
+#include <quiver/search/astar.hpp>
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/search/workspace.hpp>
+#include <quiver/reverse_index.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/typedefs.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <optional>
+#include <ranges>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// dijkstra from target along the reversed edges; the workspace holds the distances to target
+		template<typename graph_t, typename scalar_t, typename index_t, typename heap_policy_t, typename weight_invokable_t>
+		void reverse_workspace_dijkstra(reverse_index<graph_t> const& reverse, vertex_index_t target, search_workspace<scalar_t, index_t, heap_policy_t>& workspace, weight_invokable_t weight_invokable)
+		{
+			using queue_entry_t = typename search_workspace<scalar_t, index_t, heap_policy_t>::queue_entry_type;
+
+			workspace.begin(reverse.size());
+			auto& queue = workspace.heap();
+			workspace.discover(target, scalar_t(0), static_cast<index_t>(target));
+			queue.push(queue_entry_t{ static_cast<index_t>(target), scalar_t(0) });
+			while(!queue.empty()) {
+				const queue_entry_t top = queue.extract_top();
+				if(workspace.visited(top.index))
+					continue;
+				workspace.visit(top.index);
+				const auto sources = reverse.sources(top.index);
+				const auto in_edges = reverse.in_edges(top.index);
+				for(std::size_t i = 0; i < sources.size(); ++i)
+					if(!workspace.visited(sources[i])) {
+						const scalar_t distance = top.distance + scalar_t(weight_invokable(vertex_index_t(sources[i]), *in_edges[i]));
+						assert(distance >= top.distance);
+						if(workspace.relax(sources[i], distance, top.index))
+							queue.push(queue_entry_t{ sources[i], distance });
+					}
+			}
+		}
+	}
+
+	enum landmark_selection_t
+	{
+		farthest_selection,	// each landmark is the vertex farthest from its nearest previous one
+		avoid_selection		// each landmark is a leaf in the region which the previous ones bound worst
+	};
+
+	// The distances from and to a few landmarks, which bound the distance between any two vertices from below
+	// by the triangle inequality: d(v, t) >= d(L, t) - d(L, v) and d(v, t) >= d(v, L) - d(t, L). These bounds are
+	// consistent, so lower_bound serves as the heuristic of astar, which is then known as ALT. The tables take
+	// k * V scalars, twice that for directed graphs, and have to be rebuilt when the weights change.
+	template<typename scalar_t, typename index_t = vertex_index_t>
+	class alt_landmarks
+	{
+	public:
+		using scalar_type = scalar_t;
+		using vertex_index_type = index_t;
+		using workspace_type = search_workspace<scalar_t, index_t>;
+
+	private:
+		std::vector<index_t> m_landmarks;
+		// vertex * landmarks + i -> the distance from the i-th landmark to vertex
+		std::vector<scalar_t> m_from;
+		// vertex * landmarks + i -> the distance from vertex to the i-th landmark; empty for undirected graphs
+		std::vector<scalar_t> m_to;
+		bool m_directed = true;
+
+		void store(std::vector<scalar_t>& table, std::size_t landmark, workspace_type const& workspace)
+		{
+			const std::size_t k = m_landmarks.size();
+			for(vertex_index_t vertex = 0; vertex * k < table.size(); ++vertex)
+				table[vertex * k + landmark] = workspace.reached(vertex) ? workspace.distance(vertex) : inf<scalar_t>;
+		}
+
+		// computes the tables of the landmarks [first, last), every search on a worker of pool
+		template<typename graph_t, typename weight_invokable_t>
+		void compute(graph_t const& graph, std::optional<reverse_index<std::remove_const_t<graph_t>>> const& reverse, std::size_t first, std::size_t last, thread_pool& pool, weight_invokable_t weight_invokable)
+		{
+			const std::size_t k = m_landmarks.size();
+			std::vector<std::size_t> tasks;
+			for(std::size_t landmark = first; landmark < last; ++landmark) {
+				tasks.push_back(landmark);
+				if(m_directed)
+					tasks.push_back(k + landmark);
+			}
+
+			std::vector<workspace_type> workspaces(pool.size());
+			pool.parallel_for(tasks.size(), 1, [&](std::size_t worker, std::size_t begin, std::size_t end) {
+				workspace_type& workspace = workspaces[worker];
+				for(std::size_t position = begin; position < end; ++position) {
+					const std::size_t task = tasks[position];
+					if(task < k) {
+						dijkstra_shortest_path(graph, m_landmarks[task], workspace, weight_invokable);
+						store(m_from, task, workspace);
+					} else {
+						detail::reverse_workspace_dijkstra(*reverse, m_landmarks[task - k], workspace, weight_invokable);
+						store(m_to, task - k, workspace);
+					}
+				}
+			});
+		}
+
+		template<typename graph_t>
+		std::optional<reverse_index<std::remove_const_t<graph_t>>> allocate(graph_t const& graph)
+		{
+			m_directed = is_directed_v<graph_t>;
+			m_from.assign(graph.V.size() * m_landmarks.size(), inf<scalar_t>);
+			std::optional<reverse_index<std::remove_const_t<graph_t>>> reverse;
+			if(m_directed) {
+				m_to.assign(graph.V.size() * m_landmarks.size(), inf<scalar_t>);
+				reverse.emplace(graph);
+			}
+			return reverse;
+		}
+
+		// the vertex which none of the landmarks reaches, if there is any, else the one farthest from its nearest
+		// landmark, given those distances
+		static index_t farthest_from(std::vector<scalar_t> const& nearest) noexcept
+		{
+			vertex_index_t result = 0;
+			for(vertex_index_t vertex = 0; vertex < nearest.size(); ++vertex) {
+				if(nearest[vertex] == inf<scalar_t>)
+					return static_cast<index_t>(vertex);
+				if(nearest[result] < nearest[vertex])
+					result = vertex;
+			}
+			return static_cast<index_t>(result);
+		}
+
+		template<typename graph_t, typename weight_invokable_t>
+		void select_farthest(graph_t const& graph, thread_pool& pool, weight_invokable_t weight_invokable)
+		{
+			const std::size_t n = graph.V.size();
+			const std::size_t k = m_landmarks.size();
+			const auto reverse = allocate(graph);
+
+			workspace_type workspace(graph);
+			// vertex -> the distance from its nearest landmark
+			std::vector<scalar_t> nearest(n, inf<scalar_t>);
+			if(k > 0) {
+				dijkstra_shortest_path(graph, 0, workspace, weight_invokable);
+				for(vertex_index_t vertex = 0; vertex < n; ++vertex)
+					nearest[vertex] = workspace.reached(vertex) ? workspace.distance(vertex) : scalar_t(0);
+			}
+			for(std::size_t i = 0; i < k; ++i) {
+				m_landmarks[i] = farthest_from(nearest);
+				if(i == 0)
+					std::fill(nearest.begin(), nearest.end(), inf<scalar_t>);
+				if(i + 1 == k)
+					break;
+				dijkstra_shortest_path(graph, m_landmarks[i], workspace, weight_invokable);
+				for(vertex_index_t vertex = 0; vertex < n; ++vertex)
+					if(workspace.reached(vertex))
+						nearest[vertex] = std::min(nearest[vertex], workspace.distance(vertex));
+			}
+			compute(graph, reverse, 0, k, pool, weight_invokable);
+		}
+
+		template<typename graph_t, typename weight_invokable_t>
+		void select_avoid(graph_t const& graph, thread_pool& pool, weight_invokable_t weight_invokable)
+		{
+			constexpr index_t none = ~index_t{};
+			const std::size_t n = graph.V.size();
+			const std::size_t k = m_landmarks.size();
+			const auto reverse = allocate(graph);
+
+			workspace_type workspace(graph);
+			std::vector<index_t> first_child(n), next_sibling(n), preorder;
+			// vertex -> the sum of the gaps in its subtree, or 0 if the subtree contains a landmark
+			std::vector<scalar_t> size(n);
+			std::vector<bool> covered(n), is_landmark(n, false);
+			// vertex -> the distance from its nearest landmark
+			std::vector<scalar_t> nearest(n, inf<scalar_t>);
+			index_t root = 0;
+			for(std::size_t i = 0; i < k; ++i) {
+				dijkstra_shortest_path(graph, root, workspace, weight_invokable);
+				std::fill(first_child.begin(), first_child.end(), none);
+				for(vertex_index_t vertex = 0; vertex < n; ++vertex)
+					if(vertex != root && workspace.reached(vertex)) {
+						const index_t parent = workspace.predecessor(vertex);
+						next_sibling[vertex] = first_child[parent];
+						first_child[parent] = static_cast<index_t>(vertex);
+					}
+				preorder.assign(1, root);
+				for(std::size_t position = 0; position < preorder.size(); ++position)
+					for(index_t child = first_child[preorder[position]]; child != none; child = next_sibling[child])
+						preorder.push_back(child);
+
+				// the gap of a vertex is by how much the landmarks so far underestimate its distance from root
+				index_t heaviest = none;
+				for(auto iter = preorder.rbegin(); iter != preorder.rend(); ++iter) {
+					const index_t vertex = *iter;
+					covered[vertex] = is_landmark[vertex];
+					size[vertex] = workspace.distance(vertex) - lower_bound(root, vertex);
+					for(index_t child = first_child[vertex]; child != none; child = next_sibling[child]) {
+						covered[vertex] = covered[vertex] || covered[child];
+						size[vertex] += size[child];
+					}
+					if(covered[vertex])
+						size[vertex] = scalar_t(0);
+					else if(heaviest == none || size[heaviest] < size[vertex])
+						heaviest = vertex;
+				}
+
+				index_t landmark = heaviest;
+				if(landmark != none) {
+					// descend along the heaviest children to a leaf
+					for(index_t child = first_child[landmark]; child != none; child = first_child[landmark]) {
+						landmark = child;
+						for(; child != none; child = next_sibling[child])
+							if(size[landmark] < size[child])
+								landmark = child;
+					}
+				} else {
+					// root only reaches landmarks
+					landmark = farthest_from(nearest);
+					if(is_landmark[landmark])
+						landmark = static_cast<index_t>(std::find(is_landmark.begin(), is_landmark.end(), false) - is_landmark.begin());
+				}
+				m_landmarks[i] = landmark;
+				is_landmark[landmark] = true;
+				// lower_bound needs the tables of the landmark before the next selection
+				compute(graph, reverse, i, i + 1, pool, weight_invokable);
+				for(vertex_index_t vertex = 0; vertex < n; ++vertex)
+					nearest[vertex] = std::min(nearest[vertex], m_from[vertex * k + i]);
+				root = farthest_from(nearest);
+			}
+		}
+
+	public:
+		// Takes the given landmarks and runs the 2k searches, or k for undirected graphs, on the workers of pool.
+		// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t) and may be invoked concurrently.
+		template<typename graph_t, typename weight_invokable_t>
+		alt_landmarks(graph_t const& graph, std::ranges::input_range auto const& landmarks, thread_pool& pool, weight_invokable_t weight_invokable)
+		{
+			for(vertex_index_t landmark : landmarks) {
+				assert(landmark < graph.V.size());
+				m_landmarks.push_back(static_cast<index_t>(landmark));
+			}
+			const auto reverse = allocate(graph);
+			compute(graph, reverse, 0, m_landmarks.size(), pool, weight_invokable);
+		}
+		// Picks k landmarks by selection and runs the searches to them on pool. farthest_selection takes a vertex
+		// which none of the previous landmarks reaches, if there is any, else the one farthest from its nearest
+		// previous landmark; the first one is the vertex farthest from vertex 0. avoid_selection (Goldberg and
+		// Werneck) grows the shortest path tree of the vertex farthest from the landmarks, weighs every vertex by
+		// how much the landmarks underestimate its distance from the root, summed over its subtree, and descends
+		// from the heaviest vertex along the heaviest children to a leaf, skipping the subtrees which contain a
+		// landmark. It costs more searches but bounds the distances in the avoided regions more tightly. The
+		// selection is sequential; the searches which build the tables run on the workers of pool.
+		template<typename graph_t, typename weight_invokable_t>
+		alt_landmarks(graph_t const& graph, std::size_t k, landmark_selection_t selection, thread_pool& pool, weight_invokable_t weight_invokable)
+		{
+			m_landmarks.resize(std::min(k, graph.V.size()));
+			switch(selection) {
+				case farthest_selection:
+					select_farthest(graph, pool, weight_invokable);
+					break;
+				case avoid_selection:
+					select_avoid(graph, pool, weight_invokable);
+					break;
+			}
+		}
+		template<typename graph_t, typename weight_invokable_t>
+		alt_landmarks(graph_t const& graph, std::size_t k, thread_pool& pool, weight_invokable_t weight_invokable)
+		: alt_landmarks(graph, k, farthest_selection, pool, weight_invokable)
+		{
+		}
+		template<typename graph_t>
+		alt_landmarks(graph_t const& graph, std::size_t k, landmark_selection_t selection = farthest_selection)
+		{
+			thread_pool pool;
+			*this = alt_landmarks(graph, k, selection, pool, dijkstra_default_weight_invokable<graph_t>());
+		}
+
+		std::size_t size() const noexcept
+		{
+			return m_landmarks.size();
+		}
+		std::vector<index_t> const& landmarks() const noexcept
+		{
+			return m_landmarks;
+		}
+
+		// a lower bound of the distance from vertex to target
+		[[nodiscard]] scalar_t lower_bound(vertex_index_t vertex, vertex_index_t target) const noexcept
+		{
+			const std::size_t k = m_landmarks.size();
+			assert(k == 0 || (vertex * k < m_from.size() && target * k < m_from.size()));
+			std::vector<scalar_t> const& to = m_directed ? m_to : m_from;
+			scalar_t result = scalar_t(0);
+			for(std::size_t i = 0; i < k; ++i) {
+				// landmarks which don't reach both vertices, or aren't reached from both, tell nothing
+				scalar_t const& from_landmark_to_target = m_from[target * k + i];
+				scalar_t const& from_landmark_to_vertex = m_from[vertex * k + i];
+				if(from_landmark_to_target != inf<scalar_t> && from_landmark_to_vertex < from_landmark_to_target)
+					result = std::max(result, from_landmark_to_target - from_landmark_to_vertex);
+				scalar_t const& from_vertex_to_landmark = to[vertex * k + i];
+				scalar_t const& from_target_to_landmark = to[target * k + i];
+				if(from_vertex_to_landmark != inf<scalar_t> && from_target_to_landmark < from_vertex_to_landmark)
+					result = std::max(result, from_vertex_to_landmark - from_target_to_landmark);
+			}
+			return result;
+		}
+		// the heuristic of astar for searches towards target
+		[[nodiscard]] auto heuristic(vertex_index_t target) const noexcept
+		{
+			return [this, target](vertex_index_t vertex) noexcept {
+				return lower_bound(vertex, target);
+			};
+		}
+	};
+
+	template<typename graph_t, typename weight_invokable_t>
+	alt_landmarks(graph_t const&, std::size_t, thread_pool&, weight_invokable_t) -> alt_landmarks<std::invoke_result_t<weight_invokable_t, vertex_index_t, typename graph_t::out_edge_t const>, typename graph_t::vertex_index_type>;
+	template<typename graph_t, std::ranges::input_range landmarks_t, typename weight_invokable_t>
+	alt_landmarks(graph_t const&, landmarks_t const&, thread_pool&, weight_invokable_t) -> alt_landmarks<std::invoke_result_t<weight_invokable_t, vertex_index_t, typename graph_t::out_edge_t const>, typename graph_t::vertex_index_type>;
+	template<typename graph_t, typename weight_invokable_t>
+	alt_landmarks(graph_t const&, std::size_t, landmark_selection_t, thread_pool&, weight_invokable_t) -> alt_landmarks<std::invoke_result_t<weight_invokable_t, vertex_index_t, typename graph_t::out_edge_t const>, typename graph_t::vertex_index_type>;
+	template<typename graph_t>
+	alt_landmarks(graph_t const&, std::size_t) -> alt_landmarks<std::remove_cvref_t<weight_type<graph_t>>, typename graph_t::vertex_index_type>;
+	template<typename graph_t>
+	alt_landmarks(graph_t const&, std::size_t, landmark_selection_t) -> alt_landmarks<std::remove_cvref_t<weight_type<graph_t>>, typename graph_t::vertex_index_type>;
+
+	// astar from start to target guided by the lower bounds of landmarks, which have to be built from graph
+	// with the same weight_invokable. Returns the search_path_t to target.
+	template<typename heap_policy_t = binary_heap_policy, typename graph_t, typename scalar_t, typename index_t, typename weight_invokable_t>
+	[[nodiscard]] auto alt_shortest_path_to(graph_t& graph, vertex_index_t start, vertex_index_t target, alt_landmarks<scalar_t, index_t> const& landmarks, weight_invokable_t weight_invokable)
+	{
+		return astar_shortest_path_to<heap_policy_t>(graph, start, target, landmarks.heuristic(target), weight_invokable);
+	}
+	template<typename heap_policy_t = binary_heap_policy, typename graph_t, typename scalar_t, typename index_t>
+	[[nodiscard]] auto alt_shortest_path_to(graph_t& graph, vertex_index_t start, vertex_index_t target, alt_landmarks<scalar_t, index_t> const& landmarks)
+	{
+		return alt_shortest_path_to<heap_policy_t>(graph, start, target, landmarks, dijkstra_default_weight_invokable<graph_t>());
+	}
+}
+
+#endif // !QUIVER_SEARCH_ALT_HPP_INCLUDED
@@ -0,0 +1,165 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_ASTAR_HPP_INCLUDED
+#define QUIVER_SEARCH_ASTAR_HPP_INCLUDED
+
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/search/workspace.hpp>
+#include <quiver/search/visitation_table.hpp>
+#include <quiver/heaps.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <ranges>
+#include <vector>
+#include <utility>
+#include <cassert>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// A dijkstra_queue_entry_t, including its additional_t mixins, which is ordered by its distance plus the
+		// heuristic of its vertex rather than by its distance alone.
+		template<typename entry_t, typename scalar_t>
+		struct astar_queue_entry_t : public entry_t
+		{
+			scalar_t estimate;
+
+			[[nodiscard]] constexpr astar_queue_entry_t(entry_t&& entry, scalar_t&& heuristic)
+			: entry_t(std::move(entry)), estimate(this->distance + std::move(heuristic))
+			{
+			}
+		};
+		template<typename entry_t, typename scalar_t>
+		[[nodiscard]] constexpr bool operator<(astar_queue_entry_t<entry_t, scalar_t> const& lhs, astar_queue_entry_t<entry_t, scalar_t> const& rhs)
+		{
+			return lhs.estimate < rhs.estimate;
+		}
+
+		template<typename heap_policy_t, template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename heuristic_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+		bool basic_astar(graph_t& graph, std::ranges::input_range auto const& start, heuristic_t heuristic, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+			using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
+			using entry_t = basic_queue_entry_t<out_edge_t, scalar_t>;
+			using queue_entry_t = astar_queue_entry_t<entry_t, scalar_t>;
+
+			using queue_t = typename heap_policy_t::template templ<queue_entry_t>;
+			static_assert(priority_heap<queue_t>);
+			static_assert(!keys_on_distance_v<heap_policy_t, queue_entry_t>, "heap_policy_t orders by the distance instead of the estimate");
+
+			queue_t queue;
+			for(vertex_index_t index : start) {
+				assert(index < graph.V.size());
+				queue.push(entry_t(static_cast<typename entry_t::vertex_index_type>(index)), scalar_t(heuristic(index)));
+			}
+
+			while(!queue.empty()) {
+				queue_entry_t const& top = queue.top();
+				if(has_been_visited(std::as_const(top.index))) {
+					queue.pop();
+					continue;
+				}
+				if(top.apply_to(visitor))
+					return true;
+
+				entry_t extracted = queue.extract_top();
+				for(out_edge_t const& edge : graph.V[extracted.index].out_edges)
+					if(!has_been_visited(edge.to)) {
+						scalar_t&& edge_weight = weight_invokable(std::as_const(extracted.index), edge);
+						assert(std::as_const(extracted.distance) + std::as_const(edge_weight) >= std::as_const(extracted.distance));
+						queue.push(entry_t(edge.to, std::move(edge_weight), edge, std::move(extracted)), scalar_t(heuristic(vertex_index_t(edge.to))));
+					}
+			}
+			return false;
+		}
+	}
+
+	// Dijkstra's algorithm, guided towards a goal by heuristic, which shall have the signature scalar_t(vertex_index_t)
+	// and estimate the distance from a vertex to the goal. The heuristic shall be consistent, i.e. it shall
+	// never exceed the weight of an edge plus the heuristic of its target, and thus be 0 at the goal; then, every
+	// vertex is visited with its shortest distance, like in dijkstra, but the vertices far off the goal later.
+	// visitor shall have the signature bool(vertex_index_t, scalar_t).
+	// If visitor returns true, exit the search and return true, e.g. once it visits the goal.
+	// Returns false if no visitation returned true.
+	// has_been_visited shall have the signature bool(vertex_index_t)
+	// and shall return true iff the vertex has been visited by visitor.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	template<typename heap_policy_t = binary_heap_policy, typename graph_t, typename heuristic_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	bool astar(graph_t& graph, std::ranges::input_range auto const& start, heuristic_t heuristic, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
+	{
+		return detail::basic_astar<heap_policy_t, detail::bind_dijkstra_queue_entry_t<>::templ, graph_t, heuristic_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, start, heuristic, visitor, has_been_visited, weight_invokable);
+	}
+	template<typename heap_policy_t = binary_heap_policy, typename graph_t, typename heuristic_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	bool astar(graph_t& graph, vertex_index_t start, heuristic_t heuristic, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
+	{
+		return astar<heap_policy_t, graph_t, heuristic_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, std::ranges::single_view(start), heuristic, visitor, has_been_visited, weight_invokable);
+	}
+	template<typename heap_policy_t = binary_heap_policy, typename graph_t, typename heuristic_t, typename visitor_t, visited_predicate has_been_visited_t>
+	bool astar(graph_t& graph, std::ranges::input_range auto const& start, heuristic_t heuristic, visitor_t visitor, has_been_visited_t has_been_visited)
+	{
+		return astar<heap_policy_t, graph_t, heuristic_t, visitor_t, has_been_visited_t>(graph, start, heuristic, visitor, has_been_visited, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename heap_policy_t = binary_heap_policy, typename graph_t, typename heuristic_t, typename visitor_t, visited_predicate has_been_visited_t>
+	bool astar(graph_t& graph, vertex_index_t start, heuristic_t heuristic, visitor_t visitor, has_been_visited_t has_been_visited)
+	{
+		return astar<heap_policy_t, graph_t, heuristic_t, visitor_t, has_been_visited_t>(graph, std::ranges::single_view(start), heuristic, visitor, has_been_visited);
+	}
+	template<typename heap_policy_t = binary_heap_policy, typename graph_t, typename heuristic_t, typename visitor_t>
+	bool astar(graph_t& graph, std::ranges::input_range auto const& start, heuristic_t heuristic, visitor_t visitor)
+	{
+		visitation_table_t visitation_table(graph);
+		return astar<heap_policy_t, graph_t, heuristic_t, decltype(visitation_table.hook_visitor(visitor)), visitation_table_t&>(graph, start, heuristic, visitation_table.hook_visitor(visitor), visitation_table);
+	}
+	template<typename heap_policy_t = binary_heap_policy, typename graph_t, typename heuristic_t, typename visitor_t>
+	bool astar(graph_t& graph, vertex_index_t start, heuristic_t heuristic, visitor_t visitor)
+	{
+		return astar<heap_policy_t, graph_t, heuristic_t, visitor_t>(graph, std::ranges::single_view(start), heuristic, visitor);
+	}
+
+	// Searches from start, which may be a single vertex or a range of vertices, towards target and stops as soon as it
+	// visits target. Returns the search_path_t to target. heuristic shall be consistent with respect to target, see astar.
+	template<typename heap_policy_t = binary_heap_policy, typename graph_t, typename heuristic_t, typename weight_invokable_t>
+	[[nodiscard]] auto astar_shortest_path_to(graph_t& graph, auto const& start, vertex_index_t target, heuristic_t heuristic, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
+		using index_t = typename graph_t::vertex_index_type;
+
+		assert(target < graph.V.size());
+		std::vector<index_t> predecessors(graph.V.size());
+		search_path_t<scalar_t> result;
+		auto visitor = [&](vertex_index_t vertex, scalar_t distance, vertex_index_t predecessor) -> bool {
+			predecessors[vertex] = static_cast<index_t>(predecessor);
+			if(vertex != target)
+				return false;
+			result.distance = distance;
+			return true;
+		};
+		visitation_table_t visitation_table(graph);
+		auto hooked_visitor = visitation_table.hook_visitor(visitor);
+		const bool reached = detail::basic_astar<heap_policy_t, detail::bind_dijkstra_queue_entry_t<detail::dijkstra_predecessor_t>::templ, graph_t, heuristic_t, decltype(hooked_visitor), visitation_table_t&, weight_invokable_t>(graph, detail::as_vertex_range(start), heuristic, hooked_visitor, visitation_table, weight_invokable);
+		if(reached) {
+			for(vertex_index_t index = target;; index = predecessors[index]) {
+				result.vertices.push_back(index);
+				if(predecessors[index] == index)
+					break;
+			}
+			std::reverse(result.vertices.begin(), result.vertices.end());
+		}
+		return result;
+	}
+	template<typename heap_policy_t = binary_heap_policy, typename graph_t, typename heuristic_t>
+	[[nodiscard]] auto astar_shortest_path_to(graph_t& graph, auto const& start, vertex_index_t target, heuristic_t heuristic)
+	{
+		return astar_shortest_path_to<heap_policy_t>(graph, start, target, heuristic, dijkstra_default_weight_invokable<graph_t>());
+	}
+}
+
+#endif // !QUIVER_SEARCH_ASTAR_HPP_INCLUDED
@@ -0,0 +1,211 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_BELLMAN_FORD_HPP_INCLUDED
+#define QUIVER_SEARCH_BELLMAN_FORD_HPP_INCLUDED
+
+#include <quiver/search/all_pairs.hpp>
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/exception.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <ranges>
+#include <vector>
+#include <deque>
+#include <span>
+#include <utility>
+#include <cassert>
+#include <cstddef>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// the result of bellman_ford_shortest_path and spfa_shortest_path with every vertex of start at distance 0
+		template<typename graph_t, typename weight_invokable_t>
+		auto negative_search_result(graph_t const& graph, std::ranges::input_range auto const& start)
+		{
+			using scalar_t = weight_scalar_t<graph_t, weight_invokable_t>;
+			using index_t = typename graph_t::vertex_index_type;
+
+			constexpr index_t no_predecessor = ~index_t{};
+			std::vector<std::pair<scalar_t, index_t>> result(graph.V.size(), { inf<scalar_t>, no_predecessor });
+			for(vertex_index_t index : start) {
+				assert(index < graph.V.size());
+				result[index] = { scalar_t(0), static_cast<index_t>(index) };
+			}
+			return result;
+		}
+	}
+
+	// Return type is a map from vertex index to (distance from start, predecessor), as of dijkstra_shortest_path,
+	// but weights may be negative. Relaxes every edge in rounds until one of them changes nothing, which takes at
+	// most V - 1 rounds; throws negative_cycle if a round after those still does, i.e. start reaches a negative cycle.
+	// Note that in undirected graphs, every edge of negative weight is a negative cycle.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto bellman_ford_shortest_path(graph_t const& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = detail::weight_scalar_t<graph_t, weight_invokable_t>;
+		using index_t = typename graph_t::vertex_index_type;
+
+		auto result = detail::negative_search_result<graph_t, weight_invokable_t>(graph, start);
+		const std::size_t n = graph.V.size();
+		for(std::size_t round = 0; round <= n; ++round) {
+			bool changed = false;
+			for(vertex_index_t from = 0; from < n; ++from) {
+				const scalar_t from_distance = result[from].first;
+				if(from_distance == inf<scalar_t>)
+					continue;
+				for(out_edge_t const& edge : graph.V[from].out_edges) {
+					const scalar_t distance = from_distance + scalar_t(weight_invokable(from, edge));
+					if(distance < result[edge.to].first) {
+						result[edge.to] = { distance, static_cast<index_t>(from) };
+						changed = true;
+					}
+				}
+			}
+			if(!changed)
+				return result;
+		}
+		throw negative_cycle{ "bellman_ford_shortest_path: graph contains a negative cycle" };
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto bellman_ford_shortest_path(graph_t const& graph, vertex_index_t start, weight_invokable_t weight_invokable)
+	{
+		return bellman_ford_shortest_path(graph, std::ranges::single_view(start), weight_invokable);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto bellman_ford_shortest_path(graph_t const& graph, std::ranges::input_range auto const& start)
+	{
+		return bellman_ford_shortest_path(graph, start, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto bellman_ford_shortest_path(graph_t const& graph, vertex_index_t start)
+	{
+		return bellman_ford_shortest_path(graph, std::ranges::single_view(start));
+	}
+
+	// The same as bellman_ford_shortest_path, but by the shortest path faster algorithm: only the edges of the
+	// vertices whose distance has decreased, which wait in a FIFO queue, are relaxed again. A vertex whose path
+	// has V edges lies behind a negative cycle, upon which negative_cycle is thrown. The worst case is still
+	// O(V * E), but on most graphs only a few passes over each edge are necessary.
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto spfa_shortest_path(graph_t const& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = detail::weight_scalar_t<graph_t, weight_invokable_t>;
+		using index_t = typename graph_t::vertex_index_type;
+
+		auto result = detail::negative_search_result<graph_t, weight_invokable_t>(graph, start);
+		const std::size_t n = graph.V.size();
+		// vertex -> the number of edges of its current path
+		std::vector<index_t> edges(n, 0);
+		std::vector<bool> queued(n, false);
+		std::deque<index_t> queue;
+		for(vertex_index_t index = 0; index < n; ++index)
+			if(result[index].first != inf<scalar_t>) {
+				queued[index] = true;
+				queue.push_back(static_cast<index_t>(index));
+			}
+
+		while(!queue.empty()) {
+			const vertex_index_t from = queue.front();
+			queue.pop_front();
+			queued[from] = false;
+			const scalar_t from_distance = result[from].first;
+			for(out_edge_t const& edge : graph.V[from].out_edges) {
+				const scalar_t distance = from_distance + scalar_t(weight_invokable(from, edge));
+				if(distance < result[edge.to].first) {
+					result[edge.to] = { distance, static_cast<index_t>(from) };
+					edges[edge.to] = edges[from] + 1;
+					if(edges[edge.to] >= n)
+						throw negative_cycle{ "spfa_shortest_path: graph contains a negative cycle" };
+					if(!queued[edge.to]) {
+						queued[edge.to] = true;
+						queue.push_back(static_cast<index_t>(edge.to));
+					}
+				}
+			}
+		}
+		return result;
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto spfa_shortest_path(graph_t const& graph, vertex_index_t start, weight_invokable_t weight_invokable)
+	{
+		return spfa_shortest_path(graph, std::ranges::single_view(start), weight_invokable);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto spfa_shortest_path(graph_t const& graph, std::ranges::input_range auto const& start)
+	{
+		return spfa_shortest_path(graph, start, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto spfa_shortest_path(graph_t const& graph, vertex_index_t start)
+	{
+		return spfa_shortest_path(graph, std::ranges::single_view(start));
+	}
+
+	namespace detail
+	{
+		// the distances from every vertex at once, as if from an additional vertex with an edge of weight 0 to each
+		template<typename graph_t, typename weight_invokable_t>
+		auto johnson_potentials(graph_t const& graph, weight_invokable_t weight_invokable)
+		{
+			using scalar_t = weight_scalar_t<graph_t, weight_invokable_t>;
+
+			const auto distances = spfa_shortest_path(graph, std::views::iota(vertex_index_t(0), vertex_index_t(graph.V.size())), weight_invokable);
+			std::vector<scalar_t> result(distances.size());
+			std::ranges::transform(distances, result.begin(), [](auto const& entry){ return entry.first; });
+			return result;
+		}
+	}
+
+	// Writes the same matrix as all_pairs_shortest_paths, but admits negative weights. Johnson's algorithm finds
+	// the potentials h by spfa_shortest_path from all vertices at once and reweights every edge (u, v) to
+	// w(u, v) + h(u) - h(v), which is never negative, so that all_pairs_shortest_paths runs the searches on pool.
+	// Throws negative_cycle if the graph contains one. Suits sparse graphs better than floyd_warshall.
+	template<typename graph_t, typename weight_invokable_t>
+	void johnson_all_pairs_shortest_paths(graph_t& graph, std::span<detail::weight_scalar_t<graph_t, weight_invokable_t>> distances, thread_pool& pool, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = detail::weight_scalar_t<graph_t, weight_invokable_t>;
+
+		const std::vector<scalar_t> potentials = detail::johnson_potentials(graph, weight_invokable);
+		// rounding may leave floating point weights slightly below 0
+		all_pairs_shortest_paths(graph, distances, pool, [&](vertex_index_t from, out_edge_t const& edge) {
+			return std::max(scalar_t(0), scalar_t(scalar_t(weight_invokable(from, edge)) + potentials[from] - potentials[edge.to]));
+		});
+
+		const std::size_t n = graph.V.size();
+		pool.parallel_for(n, std::max<std::size_t>(1, n / (8 * pool.size())), [&](std::size_t worker, std::size_t begin, std::size_t end) {
+			(void)worker; // -Wunused-parameter
+			for(vertex_index_t from = begin; from < end; ++from) {
+				scalar_t* row = distances.data() + from * n;
+				for(vertex_index_t to = 0; to < n; ++to)
+					if(row[to] != inf<scalar_t>)
+						row[to] = row[to] - potentials[from] + potentials[to];
+			}
+		});
+	}
+	template<typename graph_t>
+	void johnson_all_pairs_shortest_paths(graph_t& graph, std::span<detail::weight_scalar_t<graph_t, decltype(dijkstra_default_weight_invokable<graph_t>())>> distances, thread_pool& pool)
+	{
+		johnson_all_pairs_shortest_paths(graph, distances, pool, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t>
+	void johnson_all_pairs_shortest_paths(graph_t& graph, std::span<detail::weight_scalar_t<graph_t, decltype(dijkstra_default_weight_invokable<graph_t>())>> distances)
+	{
+		thread_pool pool;
+		johnson_all_pairs_shortest_paths(graph, distances, pool);
+	}
+}
+
+#endif // !QUIVER_SEARCH_BELLMAN_FORD_HPP_INCLUDED
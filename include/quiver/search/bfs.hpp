@@ -9,6 +9,7 @@
 #define QUIVER_SEARCH_BFS_HPP_INCLUDED
 
 #include <quiver/search/visitation_table.hpp>
+#include <quiver/search/workspace.hpp>
 #include <quiver/adjacency_list.hpp>
 #include <quiver/util.hpp>
 #include <ranges>
@@ -18,20 +19,19 @@
 
 namespace quiver
 {
-	using bfs_path_length_t = unsigned int;
-
 	namespace detail
 	{
 		template<typename out_edge_t, template<typename, typename> typename... additional_t>
 		struct bfs_queue_entry_t : public additional_t<out_edge_t, bfs_queue_entry_t<out_edge_t, additional_t...>>...
 		{
-			vertex_index_t index;
+			using vertex_index_type = typename out_edge_t::vertex_index_type;
+			vertex_index_type index;
 
-			[[nodiscard]] constexpr bfs_queue_entry_t(vertex_index_t index)
+			[[nodiscard]] constexpr bfs_queue_entry_t(vertex_index_type index)
 			: additional_t<out_edge_t, bfs_queue_entry_t>(index)..., index(index)
 			{
 			}
-			[[nodiscard]] constexpr bfs_queue_entry_t(vertex_index_t index, out_edge_t const& edge, bfs_queue_entry_t&& previous)
+			[[nodiscard]] constexpr bfs_queue_entry_t(vertex_index_type index, out_edge_t const& edge, bfs_queue_entry_t&& previous)
 			: additional_t<out_edge_t, bfs_queue_entry_t>(std::as_const(index), edge, std::as_const(previous))..., index(index)
 			{
 			}
@@ -55,12 +55,12 @@ namespace quiver
 		{
 			bfs_path_length_t distance;
 
-			[[nodiscard]] constexpr bfs_distance_t(vertex_index_t index) noexcept
+			[[nodiscard]] constexpr bfs_distance_t(typename out_edge_t::vertex_index_type index) noexcept
 			: distance(0)
 			{
 				(void)index; // -Wunused-parameter
 			}
-			[[nodiscard]] constexpr bfs_distance_t(vertex_index_t index, out_edge_t const& edge, bfs_queue_entry_t const& previous) noexcept
+			[[nodiscard]] constexpr bfs_distance_t(typename out_edge_t::vertex_index_type index, out_edge_t const& edge, bfs_queue_entry_t const& previous) noexcept
 			: distance(previous.distance + 1)
 			{
 				(void)index; // -Wunused-parameter
@@ -76,20 +76,21 @@ namespace quiver
 		template<typename out_edge_t, typename bfs_queue_entry_t>
 		struct bfs_predecessor_t
 		{
-			vertex_index_t predecessor;
+			using vertex_index_type = typename out_edge_t::vertex_index_type;
+			vertex_index_type predecessor;
 
-			[[nodiscard]] constexpr bfs_predecessor_t(vertex_index_t index) noexcept
+			[[nodiscard]] constexpr bfs_predecessor_t(vertex_index_type index) noexcept
 			: predecessor(index)
 			{
 			}
-			[[nodiscard]] constexpr bfs_predecessor_t(vertex_index_t index, out_edge_t const& edge, bfs_queue_entry_t const& previous) noexcept
+			[[nodiscard]] constexpr bfs_predecessor_t(vertex_index_type index, out_edge_t const& edge, bfs_queue_entry_t const& previous) noexcept
 			: predecessor(previous.index)
 			{
 				(void)index; // -Wunused-parameter
 				(void)edge; // -Wunused-parameter
 			}
 
-			[[nodiscard]] constexpr vertex_index_t const& get() const noexcept
+			[[nodiscard]] constexpr vertex_index_type const& get() const noexcept
 			{
 				return predecessor;
 			}
@@ -129,6 +130,38 @@ namespace quiver
 			} while(!neighbors.empty());
 			return false;
 		}
+
+		// visitor shall have the signature bool(vertex_index_t, scalar_t, vertex_index_t).
+		template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t>
+		bool workspace_bfs(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+
+			workspace.begin(graph.V.size());
+			std::vector<index_t>& queue = workspace.indices();
+			for(vertex_index_t index : start) {
+				assert(index < graph.V.size());
+				if(!workspace.discovered(index)) {
+					workspace.discover(index, scalar_t(0), static_cast<index_t>(index));
+					queue.push_back(static_cast<index_t>(index));
+				}
+			}
+
+			for(std::size_t head = 0; head < queue.size(); ++head) {
+				const index_t index = queue[head];
+				workspace.visit(index);
+				if(visitor(vertex_index_t(index), workspace.distance(index), vertex_index_t(workspace.predecessor(index))))
+					return true;
+
+				const scalar_t distance = workspace.distance(index) + 1;
+				for(out_edge_t const& edge : graph.V[index].out_edges)
+					if(!workspace.discovered(edge.to)) {
+						workspace.discover(edge.to, distance, index);
+						queue.push_back(static_cast<index_t>(edge.to));
+					}
+			}
+			return false;
+		}
 	}
 
 	// visitor shall have the signature bool(vertex_index_t).
@@ -144,6 +177,22 @@ namespace quiver
 	{
 		return bfs<graph_t, visitor_t>(graph, std::ranges::single_view(start), visitor);
 	}
+	// Searches with the buffers of workspace, see search_workspace.
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	bool bfs(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		auto hooked_visitor = [&visitor](vertex_index_t index, scalar_t const& distance, vertex_index_t predecessor) -> bool {
+			(void)distance; // -Wunused-parameter
+			(void)predecessor; // -Wunused-parameter
+			return visitor(index);
+		};
+		return detail::workspace_bfs(graph, start, hooked_visitor, workspace);
+	}
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	bool bfs(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return bfs(graph, std::ranges::single_view(start), visitor, workspace);
+	}
 
 	// visitor shall have the signature bool(vertex_index_t, bfs_path_length_t, vertex_index_t).
 	// If visitor returns true, exit the search and return true.
@@ -164,8 +213,10 @@ namespace quiver
 	template<typename graph_t>
 	[[nodiscard]] auto bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
 	{
-		constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
-		std::vector<std::pair<bfs_path_length_t, vertex_index_t>> result(graph.V.size(), { inf<bfs_path_length_t>, no_predecessor });
+		using index_t = typename graph_t::vertex_index_type;
+
+		constexpr index_t no_predecessor = ~index_t{};
+		std::vector<std::pair<bfs_path_length_t, index_t>> result(graph.V.size(), { inf<bfs_path_length_t>, no_predecessor });
 		auto visitor = [&result](vertex_index_t vertex, bfs_path_length_t distance, vertex_index_t predecessor) -> bool {
 			result[vertex] = { distance, predecessor };
 			// maybe break; if vertex is an end node
@@ -179,6 +230,50 @@ namespace quiver
 	{
 		return bfs_shortest_path<graph_t>(graph, std::ranges::single_view(start));
 	}
+	// Searches with the buffers of workspace, see search_workspace.
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	bool bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return detail::workspace_bfs(graph, start, visitor, workspace);
+	}
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	bool bfs_shortest_path(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return detail::workspace_bfs(graph, std::ranges::single_view(start), visitor, workspace);
+	}
+	// The results are left in workspace.
+	template<typename graph_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	search_workspace<scalar_t, index_t, heap_policy_t> const& bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		auto visitor = [](vertex_index_t vertex, scalar_t const& distance, vertex_index_t predecessor) constexpr -> bool {
+			(void)vertex; // -Wunused-parameter
+			(void)distance; // -Wunused-parameter
+			(void)predecessor; // -Wunused-parameter
+			return false;
+		};
+		detail::workspace_bfs(graph, start, visitor, workspace);
+		return workspace;
+	}
+	template<typename graph_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	search_workspace<scalar_t, index_t, heap_policy_t> const& bfs_shortest_path(graph_t& graph, vertex_index_t start, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return bfs_shortest_path(graph, std::ranges::single_view(start), workspace);
+	}
+
+	// Searches from start until every vertex of targets has been visited, see dijkstra_shortest_path_to.
+	template<typename graph_t, typename targets_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	[[nodiscard]] auto bfs_shortest_path_to(graph_t& graph, auto const& start, targets_t const& targets, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return detail::search_to(targets, workspace, [&](auto visitor) {
+			detail::workspace_bfs(graph, detail::as_vertex_range(start), visitor, workspace);
+		});
+	}
+	template<typename graph_t, typename targets_t>
+	[[nodiscard]] auto bfs_shortest_path_to(graph_t& graph, auto const& start, targets_t const& targets)
+	{
+		search_workspace<bfs_path_length_t, typename graph_t::vertex_index_type> workspace(graph);
+		return bfs_shortest_path_to(graph, start, targets, workspace);
+	}
 
 	// TODO: the same TODOs as for dijkstra_shortest_path
 }
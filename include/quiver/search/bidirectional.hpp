@@ -0,0 +1,236 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_BIDIRECTIONAL_HPP_INCLUDED
+#define QUIVER_SEARCH_BIDIRECTIONAL_HPP_INCLUDED
+
+#include <quiver/search/workspace.hpp>
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/reverse_index.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// The two searches meet at an edge: the path runs from the start to from in the forward search,
+		// over the edge and from to to the target in the backward search.
+		template<typename scalar_t>
+		struct bidirectional_meeting_t
+		{
+			scalar_t distance = inf<scalar_t>;
+			vertex_index_t from;
+			vertex_index_t to;
+
+			void update(scalar_t candidate, vertex_index_t candidate_from, vertex_index_t candidate_to) noexcept
+			{
+				if(candidate < distance) {
+					distance = candidate;
+					from = candidate_from;
+					to = candidate_to;
+				}
+			}
+		};
+
+		template<typename scalar_t, typename workspace_t>
+		[[nodiscard]] search_path_t<scalar_t> bidirectional_path(bidirectional_meeting_t<scalar_t> const& meeting, workspace_t const& forward, workspace_t const& backward)
+		{
+			search_path_t<scalar_t> result;
+			if(meeting.distance == inf<scalar_t>)
+				return result;
+			result.distance = meeting.distance;
+			for(vertex_index_t index = meeting.from;; index = forward.predecessor(index)) {
+				result.vertices.push_back(index);
+				if(forward.predecessor(index) == index)
+					break;
+			}
+			std::reverse(result.vertices.begin(), result.vertices.end());
+			if(meeting.to == meeting.from)
+				result.vertices.pop_back();
+			for(vertex_index_t index = meeting.to;; index = backward.predecessor(index)) {
+				result.vertices.push_back(index);
+				if(backward.predecessor(index) == index)
+					break;
+			}
+			return result;
+		}
+
+		// pops the entries of vertices which have been visited already
+		template<typename workspace_t>
+		void skip_visited(workspace_t& workspace)
+		{
+			auto& queue = workspace.heap();
+			while(!queue.empty() && workspace.visited(queue.top().index))
+				queue.pop();
+		}
+	}
+
+	// Searches forward from start on graph and backward from target on reverse, the reverse_index of graph, and
+	// returns the search_path_t from start to target. The side whose queue has the lesser minimum advances.
+	// The searches stop once the minima of both queues add up to at least the shortest path seen so far, where
+	// every edge scanned between a vertex reached forward and a vertex reached backward contributes a path.
+	template<typename graph_t, typename scalar_t, typename index_t, typename heap_policy_t, typename weight_invokable_t>
+	[[nodiscard]] search_path_t<scalar_t> bidirectional_dijkstra_shortest_path_to(graph_t& graph, vertex_index_t start, vertex_index_t target, reverse_index<std::remove_const_t<graph_t>> const& reverse, search_workspace<scalar_t, index_t, heap_policy_t>& forward, search_workspace<scalar_t, index_t, heap_policy_t>& backward, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using queue_entry_t = typename search_workspace<scalar_t, index_t, heap_policy_t>::queue_entry_type;
+
+		assert(start < graph.V.size());
+		assert(target < graph.V.size());
+		assert(reverse.size() == graph.V.size());
+		forward.begin(graph.V.size());
+		backward.begin(graph.V.size());
+		forward.discover(start, scalar_t(0), static_cast<index_t>(start));
+		forward.heap().push(queue_entry_t{ static_cast<index_t>(start), scalar_t(0) });
+		backward.discover(target, scalar_t(0), static_cast<index_t>(target));
+		backward.heap().push(queue_entry_t{ static_cast<index_t>(target), scalar_t(0) });
+
+		detail::bidirectional_meeting_t<scalar_t> meeting;
+		if(start == target)
+			meeting.update(scalar_t(0), start, target);
+
+		for(;;) {
+			detail::skip_visited(forward);
+			detail::skip_visited(backward);
+			if(forward.heap().empty() || backward.heap().empty())
+				break;
+			const scalar_t forward_top = forward.heap().top().distance;
+			const scalar_t backward_top = backward.heap().top().distance;
+			if(!(forward_top + backward_top < meeting.distance))
+				break;
+
+			if(!(backward_top < forward_top)) {
+				const queue_entry_t top = forward.heap().extract_top();
+				forward.visit(top.index);
+				for(out_edge_t const& edge : graph.V[top.index].out_edges) {
+					if(forward.visited(edge.to))
+						continue;
+					const scalar_t distance = top.distance + scalar_t(weight_invokable(vertex_index_t(top.index), edge));
+					assert(distance >= top.distance);
+					if(forward.relax(edge.to, distance, top.index))
+						forward.heap().push(queue_entry_t{ static_cast<index_t>(edge.to), distance });
+					if(backward.discovered(edge.to))
+						meeting.update(distance + backward.distance(edge.to), top.index, edge.to);
+				}
+			} else {
+				const queue_entry_t top = backward.heap().extract_top();
+				backward.visit(top.index);
+				const auto sources = reverse.sources(top.index);
+				const auto in_edges = reverse.in_edges(top.index);
+				for(std::size_t i = 0; i < sources.size(); ++i) {
+					const vertex_index_t from = sources[i];
+					if(backward.visited(from))
+						continue;
+					const scalar_t distance = top.distance + scalar_t(weight_invokable(from, *in_edges[i]));
+					assert(distance >= top.distance);
+					if(backward.relax(from, distance, top.index))
+						backward.heap().push(queue_entry_t{ static_cast<index_t>(from), distance });
+					if(forward.discovered(from))
+						meeting.update(forward.distance(from) + distance, from, top.index);
+				}
+			}
+		}
+		return detail::bidirectional_path(meeting, forward, backward);
+	}
+	template<typename graph_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	[[nodiscard]] search_path_t<scalar_t> bidirectional_dijkstra_shortest_path_to(graph_t& graph, vertex_index_t start, vertex_index_t target, reverse_index<std::remove_const_t<graph_t>> const& reverse, search_workspace<scalar_t, index_t, heap_policy_t>& forward, search_workspace<scalar_t, index_t, heap_policy_t>& backward)
+	{
+		return bidirectional_dijkstra_shortest_path_to(graph, start, target, reverse, forward, backward, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto bidirectional_dijkstra_shortest_path_to(graph_t& graph, vertex_index_t start, vertex_index_t target, reverse_index<std::remove_const_t<graph_t>> const& reverse, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
+
+		search_workspace<scalar_t, typename graph_t::vertex_index_type> forward(graph), backward(graph);
+		return bidirectional_dijkstra_shortest_path_to(graph, start, target, reverse, forward, backward, weight_invokable);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto bidirectional_dijkstra_shortest_path_to(graph_t& graph, vertex_index_t start, vertex_index_t target, reverse_index<std::remove_const_t<graph_t>> const& reverse)
+	{
+		return bidirectional_dijkstra_shortest_path_to(graph, start, target, reverse, dijkstra_default_weight_invokable<graph_t>());
+	}
+
+	// Searches forward from start on graph and backward from target on reverse, the reverse_index of graph, and
+	// returns the search_path_t from start to target. The side with the smaller frontier expands it by a whole
+	// level. The searches stop after the first level in which they meet, as no later level can yield a shorter path.
+	template<typename graph_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	[[nodiscard]] search_path_t<scalar_t> bidirectional_bfs_shortest_path_to(graph_t& graph, vertex_index_t start, vertex_index_t target, reverse_index<std::remove_const_t<graph_t>> const& reverse, search_workspace<scalar_t, index_t, heap_policy_t>& forward, search_workspace<scalar_t, index_t, heap_policy_t>& backward)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+
+		assert(start < graph.V.size());
+		assert(target < graph.V.size());
+		assert(reverse.size() == graph.V.size());
+		forward.begin(graph.V.size());
+		backward.begin(graph.V.size());
+		forward.discover(start, scalar_t(0), static_cast<index_t>(start));
+		forward.indices().push_back(static_cast<index_t>(start));
+		backward.discover(target, scalar_t(0), static_cast<index_t>(target));
+		backward.indices().push_back(static_cast<index_t>(target));
+
+		detail::bidirectional_meeting_t<scalar_t> meeting;
+		if(start == target)
+			meeting.update(scalar_t(0), start, target);
+
+		// the frontier of a side is the part of its queue behind head
+		std::size_t forward_head = 0, backward_head = 0;
+		while(meeting.distance == inf<scalar_t>) {
+			const std::size_t forward_size = forward.indices().size() - forward_head;
+			const std::size_t backward_size = backward.indices().size() - backward_head;
+			if(forward_size == 0 || backward_size == 0)
+				break;
+
+			if(forward_size <= backward_size) {
+				std::vector<index_t>& queue = forward.indices();
+				for(const std::size_t end = queue.size(); forward_head < end; ++forward_head) {
+					const index_t index = queue[forward_head];
+					forward.visit(index);
+					const scalar_t distance = forward.distance(index) + 1;
+					for(out_edge_t const& edge : graph.V[index].out_edges) {
+						if(!forward.discovered(edge.to)) {
+							forward.discover(edge.to, distance, index);
+							queue.push_back(static_cast<index_t>(edge.to));
+						}
+						if(backward.discovered(edge.to))
+							meeting.update(distance + backward.distance(edge.to), index, edge.to);
+					}
+				}
+			} else {
+				std::vector<index_t>& queue = backward.indices();
+				for(const std::size_t end = queue.size(); backward_head < end; ++backward_head) {
+					const index_t index = queue[backward_head];
+					backward.visit(index);
+					const scalar_t distance = backward.distance(index) + 1;
+					for(vertex_index_t from : reverse.sources(index)) {
+						if(!backward.discovered(from)) {
+							backward.discover(from, distance, index);
+							queue.push_back(static_cast<index_t>(from));
+						}
+						if(forward.discovered(from))
+							meeting.update(forward.distance(from) + distance, from, index);
+					}
+				}
+			}
+		}
+		return detail::bidirectional_path(meeting, forward, backward);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto bidirectional_bfs_shortest_path_to(graph_t& graph, vertex_index_t start, vertex_index_t target, reverse_index<std::remove_const_t<graph_t>> const& reverse)
+	{
+		search_workspace<bfs_path_length_t, typename graph_t::vertex_index_type> forward(graph), backward(graph);
+		return bidirectional_bfs_shortest_path_to(graph, start, target, reverse, forward, backward);
+	}
+}
+
+#endif // !QUIVER_SEARCH_BIDIRECTIONAL_HPP_INCLUDED
@@ -0,0 +1,189 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_DELTA_STEPPING_HPP_INCLUDED
+#define QUIVER_SEARCH_DELTA_STEPPING_HPP_INCLUDED
+
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <ranges>
+#include <vector>
+#include <utility>
+#include <cassert>
+#include <cstddef>
+
+namespace quiver
+{
+	namespace detail
+	{
+		template<typename scalar_t, typename index_t>
+		struct delta_stepping_request_t
+		{
+			index_t to;
+			index_t from;
+			scalar_t distance;
+		};
+	}
+
+	// Return type is a map from vertex index to (distance from start, predecessor), like that of dijkstra_shortest_path.
+	// The distances are equal to those of dijkstra_shortest_path, but where several shortest paths tie, the
+	// predecessors may differ: among the requests which lower a distance at the same time, the one from the least
+	// vertex becomes the predecessor, so that the result does not depend on the number of workers.
+	// The vertices are kept in buckets of width delta by their tentative distance. The lowest bucket is emptied by
+	// relaxing the light edges, i.e. those not heavier than delta, of all its vertices at once, which may refill it;
+	// its heavy edges are relaxed once it stays empty. Since no tentative distance exceeds that of the lowest bucket
+	// by more than the heaviest weight, the buckets are reused cyclically, max weight / delta + 2 of them. Each
+	// relaxation is done by the workers of pool in two passes: the first one collects the requests, the second one
+	// applies them, with every worker owning a fixed share of the vertices. A small delta approaches dijkstra, a
+	// large one bellman-ford.
+	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t) and return no negative weights.
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, auto delta, thread_pool& pool, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
+		using index_t = typename graph_t::vertex_index_type;
+		using request_t = detail::delta_stepping_request_t<scalar_t, index_t>;
+
+		const scalar_t width = static_cast<scalar_t>(delta);
+		assert(scalar_t(0) < width);
+		const auto bucket_of = [width](scalar_t const& distance) {
+			return static_cast<std::size_t>(distance / width);
+		};
+
+		const std::size_t workers = pool.size();
+		std::vector<scalar_t> max_weights(workers, scalar_t(0));
+		pool.parallel_for(graph.V.size(), 1024, [&](std::size_t worker, std::size_t begin, std::size_t end) {
+			for(vertex_index_t from = begin; from < end; ++from)
+				for(out_edge_t const& edge : graph.V[from].out_edges)
+					max_weights[worker] = std::max(max_weights[worker], scalar_t(weight_invokable(from, edge)));
+		});
+		const scalar_t max_weight = *std::max_element(max_weights.begin(), max_weights.end());
+		assert(max_weight < inf<scalar_t>);
+
+		constexpr index_t no_predecessor = ~index_t{};
+		std::vector<std::pair<scalar_t, index_t>> result(graph.V.size(), { inf<scalar_t>, no_predecessor });
+		// bucket i is kept in buckets[i % buckets.size()]
+		std::vector<std::vector<index_t>> buckets(bucket_of(max_weight) + 2);
+		std::size_t pending = 0;
+		const auto enqueue = [&](index_t index) {
+			buckets[bucket_of(result[index].first) % buckets.size()].push_back(index);
+			++pending;
+		};
+		for(vertex_index_t index : start) {
+			assert(index < graph.V.size());
+			if(result[index].second == no_predecessor) {
+				result[index] = { scalar_t(0), static_cast<index_t>(index) };
+				enqueue(static_cast<index_t>(index));
+			}
+		}
+
+		// requests[worker][owner] are the requests collected by worker for the vertices of owner
+		std::vector<std::vector<std::vector<request_t>>> requests(workers, std::vector<std::vector<request_t>>(workers));
+		std::vector<std::vector<index_t>> improved(workers);
+		// vertex -> the last step in which it has been lowered or taken from a bucket
+		std::vector<std::size_t> stamp(graph.V.size(), 0);
+		std::size_t step = 0;
+
+		const auto relax = [&](std::vector<index_t> const& sources, bool light) {
+			if(sources.empty())
+				return;
+			const std::size_t grain = std::max<std::size_t>(64, sources.size() / (8 * workers));
+			pool.parallel_for(sources.size(), grain, [&](std::size_t worker, std::size_t begin, std::size_t end) {
+				std::vector<std::vector<request_t>>& outgoing = requests[worker];
+				for(std::size_t position = begin; position < end; ++position) {
+					const index_t from = sources[position];
+					scalar_t const& distance = result[from].first;
+					for(out_edge_t const& edge : graph.V[from].out_edges) {
+						const scalar_t weight = scalar_t(weight_invokable(vertex_index_t(from), edge));
+						assert(!(weight < scalar_t(0)));
+						if(!(width < weight) == light)
+							outgoing[edge.to % workers].push_back(request_t{ static_cast<index_t>(edge.to), from, distance + weight });
+					}
+				}
+			});
+			++step;
+			pool.run([&](std::size_t worker) {
+				improved[worker].clear();
+				for(std::vector<std::vector<request_t>>& outgoing : requests) {
+					for(request_t const& request : outgoing[worker]) {
+						auto& [distance, predecessor] = result[request.to];
+						if(request.distance < distance || (stamp[request.to] == step && request.distance == distance && request.from < predecessor)) {
+							if(stamp[request.to] != step) {
+								stamp[request.to] = step;
+								improved[worker].push_back(request.to);
+							}
+							distance = request.distance;
+							predecessor = request.from;
+						}
+					}
+					outgoing[worker].clear();
+				}
+			});
+			for(std::vector<index_t> const& indices : improved)
+				for(index_t index : indices)
+					enqueue(index);
+		};
+
+		std::vector<index_t> frontier, settled;
+		// vertex -> 1 + the last bucket it has been settled in
+		std::vector<std::size_t> settled_in(graph.V.size(), 0);
+		for(std::size_t current = 0; pending != 0; ++current) {
+			std::vector<index_t>& bucket = buckets[current % buckets.size()];
+			settled.clear();
+			while(!bucket.empty()) {
+				++step;
+				frontier.clear();
+				pending -= bucket.size();
+				for(index_t index : bucket)
+					if(stamp[index] != step && bucket_of(result[index].first) == current) {
+						stamp[index] = step;
+						frontier.push_back(index);
+						if(settled_in[index] != current + 1) {
+							settled_in[index] = current + 1;
+							settled.push_back(index);
+						}
+					}
+				bucket.clear();
+				relax(frontier, true);
+			}
+			relax(settled, false);
+		}
+		return result;
+	}
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, vertex_index_t start, auto delta, thread_pool& pool, weight_invokable_t weight_invokable)
+	{
+		return delta_stepping_shortest_path<graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), delta, pool, weight_invokable);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, auto delta, thread_pool& pool)
+	{
+		return delta_stepping_shortest_path<graph_t>(graph, start, delta, pool, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, vertex_index_t start, auto delta, thread_pool& pool)
+	{
+		return delta_stepping_shortest_path<graph_t>(graph, std::ranges::single_view(start), delta, pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, auto delta)
+	{
+		thread_pool pool;
+		return delta_stepping_shortest_path<graph_t>(graph, start, delta, pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto delta_stepping_shortest_path(graph_t& graph, vertex_index_t start, auto delta)
+	{
+		return delta_stepping_shortest_path<graph_t>(graph, std::ranges::single_view(start), delta);
+	}
+}
+
+#endif // !QUIVER_SEARCH_DELTA_STEPPING_HPP_INCLUDED
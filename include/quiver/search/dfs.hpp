@@ -9,6 +9,7 @@
 #define QUIVER_SEARCH_DFS_HPP_INCLUDED
 
 #include <quiver/search/visitation_table.hpp>
+#include <quiver/search/workspace.hpp>
 #include <quiver/adjacency_list.hpp>
 #include <quiver/util.hpp>
 #include <ranges>
@@ -26,16 +27,17 @@ namespace quiver
 	{
 		using vertex_t = copy_const<graph_t, typename graph_t::vertex_t>;
 		// using out_edge_t = typename graph_t::out_edge_t;
+		using index_t = typename graph_t::vertex_index_type;
 
 		std::vector<bool> enqueued(graph.V.size(), false);
-		std::stack<vertex_index_t> neighbors;
+		std::stack<index_t> neighbors;
 		for(vertex_index_t index : start) {
 			assert(index < graph.V.size());
 			enqueued[index] = true;
 			neighbors.push(index);
 		}
 		do {
-			vertex_index_t index = neighbors.top();
+			const index_t index = neighbors.top();
 			assert(enqueued[index]);
 			vertex_t& vertex = graph.V[index];
 
@@ -61,6 +63,50 @@ namespace quiver
 	{
 		return dfs<graph_t, visitor_t>(graph, std::ranges::single_view(start), visitor);
 	}
+
+	// Searches with the buffers of workspace, see search_workspace.
+	// Afterwards, the predecessors in workspace form the tree in which dfs discovered the vertices.
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	bool dfs(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		using vertex_t = copy_const<graph_t, typename graph_t::vertex_t>;
+
+		workspace.begin(graph.V.size());
+		std::vector<index_t>& neighbors = workspace.indices();
+		for(vertex_index_t index : start) {
+			assert(index < graph.V.size());
+			if(!workspace.discovered(index)) {
+				workspace.discover(index, scalar_t(0), static_cast<index_t>(index));
+				neighbors.push_back(static_cast<index_t>(index));
+			}
+		}
+
+		while(!neighbors.empty()) {
+			const index_t index = neighbors.back();
+			vertex_t& vertex = graph.V[index];
+
+			workspace.visit(index);
+			if(visitor(vertex_index_t(index)))
+				return true;
+
+			neighbors.pop_back();
+			const scalar_t depth = workspace.distance(index) + 1;
+			// reverse here so that first inserted is first visited
+			const auto begin = vertex.out_edges.rbegin();
+			const auto end = vertex.out_edges.rend();
+			for(auto iter = begin; iter != end; ++iter)
+				if(!workspace.discovered(iter->to)) {
+					workspace.discover(iter->to, depth, index);
+					neighbors.push_back(static_cast<index_t>(iter->to));
+				}
+		}
+		return false;
+	}
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	bool dfs(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return dfs(graph, std::ranges::single_view(start), visitor, workspace);
+	}
 }
 
 #endif // !QUIVER_SEARCH_DFS_HPP_INCLUDED
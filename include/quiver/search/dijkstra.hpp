@@ -9,6 +9,7 @@
 #define QUIVER_SEARCH_DIJKSTRA_HPP_INCLUDED
 
 #include <quiver/search/visitation_table.hpp>
+#include <quiver/search/workspace.hpp>
 #include <quiver/adjacency_list.hpp>
 #include <quiver/heaps.hpp>
 #include <quiver/util.hpp>
@@ -16,10 +17,21 @@
 #include <utility>
 #include <cassert>
 #include <ranges>
+#include <vector>
+#include <functional>
+#include <cstddef>
 
 namespace quiver
 {
-	// TODO: Thus far, I've only implemented the "always insert" variant of Dijkstra. I shall also implement the "decrease key" variant.
+	enum dijkstra_strategy_t
+	{
+		always_insert,	// pushes a new queue entry for every relaxation; the queue holds O(E) entries
+		decrease_key	// keeps at most one queue entry per vertex and decreases it; the queue holds O(V) entries
+	};
+
+	// always_insert takes a bucket_queue or a radix_heap for unsigned integral weights, see monotone_heap_policy
+	template<dijkstra_strategy_t strategy>
+	using dijkstra_default_heap_policy = std::conditional_t<strategy == always_insert, monotone_heap_policy, binary_heap_policy>;
 
 	template<typename graph_t>
 	[[nodiscard]] constexpr auto dijkstra_default_weight_invokable() noexcept
@@ -36,14 +48,15 @@ namespace quiver
 		template<typename out_edge_t, typename scalar_t, template<typename, typename, typename> typename... additional_t>
 		struct dijkstra_queue_entry_t : public additional_t<out_edge_t, scalar_t, dijkstra_queue_entry_t<out_edge_t, scalar_t, additional_t...>>...
 		{
-			vertex_index_t index;
+			using vertex_index_type = typename out_edge_t::vertex_index_type;
+			vertex_index_type index;
 			scalar_t distance;
 
-			[[nodiscard]] constexpr dijkstra_queue_entry_t(vertex_index_t index)
+			[[nodiscard]] constexpr dijkstra_queue_entry_t(vertex_index_type index)
 			: additional_t<out_edge_t, scalar_t, dijkstra_queue_entry_t>(std::as_const(index))..., index(index), distance(0)
 			{
 			}
-			[[nodiscard]] constexpr dijkstra_queue_entry_t(vertex_index_t index, scalar_t&& distance, out_edge_t const& edge, dijkstra_queue_entry_t&& previous)
+			[[nodiscard]] constexpr dijkstra_queue_entry_t(vertex_index_type index, scalar_t&& distance, out_edge_t const& edge, dijkstra_queue_entry_t&& previous)
 			: additional_t<out_edge_t, scalar_t, dijkstra_queue_entry_t>(std::as_const(index), std::as_const(distance), edge, std::as_const(previous))..., index(index), distance(std::move(previous.distance) + std::move(distance))
 			{
 			}
@@ -70,13 +83,14 @@ namespace quiver
 		template<typename out_edge_t, typename scalar_t, typename dijkstra_queue_entry_t>
 		struct dijkstra_predecessor_t
 		{
-			vertex_index_t predecessor;
+			using vertex_index_type = typename out_edge_t::vertex_index_type;
+			vertex_index_type predecessor;
 
-			[[nodiscard]] constexpr dijkstra_predecessor_t(vertex_index_t index) noexcept
+			[[nodiscard]] constexpr dijkstra_predecessor_t(vertex_index_type index) noexcept
 			: predecessor(index)
 			{
 			}
-			[[nodiscard]] constexpr dijkstra_predecessor_t(vertex_index_t index, scalar_t const& distance, out_edge_t const& edge, dijkstra_queue_entry_t const& previous) noexcept
+			[[nodiscard]] constexpr dijkstra_predecessor_t(vertex_index_type index, scalar_t const& distance, out_edge_t const& edge, dijkstra_queue_entry_t const& previous) noexcept
 			: predecessor(previous.index)
 			{
 				(void)index; // -Wunused-parameter
@@ -84,22 +98,23 @@ namespace quiver
 				(void)edge; // -Wunused-parameter
 			}
 
-			[[nodiscard]] constexpr vertex_index_t const& get() const noexcept
+			[[nodiscard]] constexpr vertex_index_type const& get() const noexcept
 			{
 				return predecessor;
 			}
 		};
 
-		// TODO: let the caller choose the heap data structure
-
-		template<template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
-		bool basic_dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
+		template<typename heap_policy_t, template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+		bool basic_dijkstra_always_insert(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
 		{
 			using out_edge_t = typename graph_t::out_edge_t;
 			using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
 			using queue_entry_t = basic_queue_entry_t<out_edge_t, scalar_t>;
 
-			binary_heap<queue_entry_t> queue;
+			using queue_t = typename heap_policy_t::template templ<queue_entry_t>;
+			static_assert(priority_heap<queue_t>);
+
+			queue_t queue;
 			for(vertex_index_t index : start) {
 				assert(index < graph.V.size());
 				queue.push(index);
@@ -126,6 +141,110 @@ namespace quiver
 			} while(!queue.empty());
 			return false;
 		}
+
+		template<typename heap_policy_t, template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+		bool basic_dijkstra_decrease_key(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+			using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
+			using queue_entry_t = basic_queue_entry_t<out_edge_t, scalar_t>;
+			using index_t = typename graph_t::vertex_index_type;
+			using untracked_queue_t = typename heap_policy_t::template templ<queue_entry_t>;
+			static_assert(addressable_heap<untracked_queue_t>, "decrease_key requires an addressable heap");
+			using handle_t = typename untracked_queue_t::handle_type;
+			using handle_storage_t = std::conditional_t<std::is_integral_v<handle_t>, index_t, handle_t>;
+			constexpr handle_storage_t not_queued = static_cast<handle_storage_t>(untracked_queue_t::null_handle);
+
+			// vertex -> handle of its entry in the queue; positions in implicit heaps are bounded by |V| and stored as index_t
+			std::vector<handle_storage_t> position(graph.V.size(), not_queued);
+			auto position_tracker = [&position](queue_entry_t const& entry, handle_t handle) noexcept {
+				position[entry.index] = static_cast<handle_storage_t>(handle);
+			};
+			using queue_t = typename heap_policy_t::template templ<queue_entry_t, decltype(position_tracker)>;
+			static_assert(std::is_same_v<typename queue_t::handle_type, handle_t>);
+			queue_t queue(std::less<>{}, position_tracker);
+			for(vertex_index_t index : start) {
+				assert(index < graph.V.size());
+				if(position[index] == not_queued)
+					queue.push(index);
+			}
+
+			do {
+				// The reason we don't already .extract_top here is because it
+				// causes unnecessary workload in case visitor returns true.
+				queue_entry_t const& top = queue.top();
+				position[top.index] = not_queued;
+				if(has_been_visited(std::as_const(top.index))) {
+					queue.pop();
+					continue;
+				}
+				if(top.apply_to(visitor))
+					return true;
+
+				queue_entry_t extracted = queue.extract_top();
+				for(out_edge_t const& edge : graph.V[extracted.index].out_edges)
+					if(!has_been_visited(edge.to)) {
+						scalar_t&& edge_weight = weight_invokable(std::as_const(extracted.index), edge);
+						assert(std::as_const(extracted.distance) + std::as_const(edge_weight) >= std::as_const(extracted.distance));
+						const handle_storage_t edge_position = position[edge.to];
+						if(edge_position == not_queued) {
+							queue.push(edge.to, std::move(edge_weight), edge, std::move(extracted));
+						} else {
+							queue_entry_t candidate(edge.to, std::move(edge_weight), edge, std::move(extracted));
+							if(candidate.distance < queue.get(static_cast<handle_t>(edge_position)).distance)
+								queue.decrease(static_cast<handle_t>(edge_position), std::move(candidate));
+						}
+					}
+			} while(!queue.empty());
+			return false;
+		}
+
+		template<dijkstra_strategy_t strategy, typename heap_policy_t, template<typename, typename> typename basic_queue_entry_t, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+		bool basic_dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
+		{
+			if constexpr(strategy == always_insert)
+				return basic_dijkstra_always_insert<heap_policy_t, basic_queue_entry_t, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, start, visitor, has_been_visited, weight_invokable);
+			else if constexpr(strategy == decrease_key)
+				return basic_dijkstra_decrease_key<heap_policy_t, basic_queue_entry_t, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, start, visitor, has_been_visited, weight_invokable);
+		}
+
+		// visitor shall have the signature bool(vertex_index_t, scalar_t, vertex_index_t).
+		// The tentative distances and predecessors live in workspace, so the queue only holds (index, distance)
+		// and receives a new entry only if the distance of a vertex decreases.
+		template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t, typename weight_invokable_t>
+		bool workspace_dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace, weight_invokable_t weight_invokable)
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+			using queue_entry_t = typename search_workspace<scalar_t, index_t, heap_policy_t>::queue_entry_type;
+
+			workspace.begin(graph.V.size());
+			auto& queue = workspace.heap();
+			for(vertex_index_t index : start) {
+				assert(index < graph.V.size());
+				if(!workspace.discovered(index)) {
+					workspace.discover(index, scalar_t(0), static_cast<index_t>(index));
+					queue.push(queue_entry_t{ static_cast<index_t>(index), scalar_t(0) });
+				}
+			}
+
+			while(!queue.empty()) {
+				const queue_entry_t top = queue.extract_top();
+				if(workspace.visited(top.index))
+					continue;
+				workspace.visit(top.index);
+				if(visitor(vertex_index_t(top.index), top.distance, vertex_index_t(workspace.predecessor(top.index))))
+					return true;
+
+				for(out_edge_t const& edge : graph.V[top.index].out_edges)
+					if(!workspace.visited(edge.to)) {
+						const scalar_t distance = top.distance + scalar_t(weight_invokable(vertex_index_t(top.index), edge));
+						assert(distance >= top.distance);
+						if(workspace.relax(edge.to, distance, top.index))
+							queue.push(queue_entry_t{ static_cast<index_t>(edge.to), distance });
+					}
+			}
+			return false;
+		}
 	}
 
 	// visitor shall have the signature bool(vertex_index_t, scalar_t).
@@ -134,36 +253,63 @@ namespace quiver
 	// has_been_visited shall have the signature bool(vertex_index_t)
 	// and shall return true iff the vertex has been visited by visitor.
 	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
-	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	// heap_policy_t selects the queue, e.g. d_ary_heap_policy<4>; decrease_key requires an addressable_heap.
+	// The default depends on strategy, see dijkstra_default_heap_policy.
+	template<dijkstra_strategy_t strategy = always_insert, typename heap_policy_t = dijkstra_default_heap_policy<strategy>, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
 	bool dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
 	{
-		return detail::basic_dijkstra<detail::bind_dijkstra_queue_entry_t<>::templ, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, start, visitor, has_been_visited, weight_invokable);
+		return detail::basic_dijkstra<strategy, heap_policy_t, detail::bind_dijkstra_queue_entry_t<>::templ, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, start, visitor, has_been_visited, weight_invokable);
 	}
-	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	template<dijkstra_strategy_t strategy = always_insert, typename heap_policy_t = dijkstra_default_heap_policy<strategy>, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
 	bool dijkstra(graph_t& graph, vertex_index_t start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
 	{
-		return dijkstra<graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, std::ranges::single_view(start), visitor, has_been_visited, weight_invokable);
+		return dijkstra<strategy, heap_policy_t, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, std::ranges::single_view(start), visitor, has_been_visited, weight_invokable);
 	}
-	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t>
+	template<dijkstra_strategy_t strategy = always_insert, typename heap_policy_t = dijkstra_default_heap_policy<strategy>, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t>
 	bool dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited)
 	{
-		return dijkstra<graph_t, visitor_t, has_been_visited_t>(graph, start, visitor, has_been_visited, dijkstra_default_weight_invokable<graph_t>());
+		return dijkstra<strategy, heap_policy_t, graph_t, visitor_t, has_been_visited_t>(graph, start, visitor, has_been_visited, dijkstra_default_weight_invokable<graph_t>());
 	}
-	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t>
+	template<dijkstra_strategy_t strategy = always_insert, typename heap_policy_t = dijkstra_default_heap_policy<strategy>, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t>
 	bool dijkstra(graph_t& graph, vertex_index_t start, visitor_t visitor, has_been_visited_t has_been_visited)
 	{
-		return dijkstra<graph_t, visitor_t, has_been_visited_t>(graph, std::ranges::single_view(start), visitor, has_been_visited);
+		return dijkstra<strategy, heap_policy_t, graph_t, visitor_t, has_been_visited_t>(graph, std::ranges::single_view(start), visitor, has_been_visited);
 	}
-	template<typename graph_t, typename visitor_t>
+	template<dijkstra_strategy_t strategy = always_insert, typename heap_policy_t = dijkstra_default_heap_policy<strategy>, typename graph_t, typename visitor_t>
 	bool dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor)
 	{
 		visitation_table_t visitation_table(graph);
-		return dijkstra<graph_t, decltype(visitation_table.hook_visitor(visitor)), visitation_table_t&>(graph, start, visitation_table.hook_visitor(visitor), visitation_table);
+		return dijkstra<strategy, heap_policy_t, graph_t, decltype(visitation_table.hook_visitor(visitor)), visitation_table_t&>(graph, start, visitation_table.hook_visitor(visitor), visitation_table);
 	}
-	template<typename graph_t, typename visitor_t>
+	template<dijkstra_strategy_t strategy = always_insert, typename heap_policy_t = dijkstra_default_heap_policy<strategy>, typename graph_t, typename visitor_t>
 	bool dijkstra(graph_t& graph, vertex_index_t start, visitor_t visitor)
 	{
-		return dijkstra<graph_t, visitor_t>(graph, std::ranges::single_view(start), visitor);
+		return dijkstra<strategy, heap_policy_t, graph_t, visitor_t>(graph, std::ranges::single_view(start), visitor);
+	}
+	// Searches with the buffers of workspace, see search_workspace. The queue is workspace.heap().
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t, typename weight_invokable_t>
+	bool dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		auto hooked_visitor = [&visitor](vertex_index_t index, scalar_t const& distance, vertex_index_t predecessor) -> bool {
+			(void)predecessor; // -Wunused-parameter
+			return visitor(index, distance);
+		};
+		return detail::workspace_dijkstra(graph, start, hooked_visitor, workspace, weight_invokable);
+	}
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t, typename weight_invokable_t>
+	bool dijkstra(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return dijkstra(graph, std::ranges::single_view(start), visitor, workspace, weight_invokable);
+	}
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	bool dijkstra(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return dijkstra(graph, start, visitor, workspace, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	bool dijkstra(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return dijkstra(graph, std::ranges::single_view(start), visitor, workspace);
 	}
 
 	// visitor shall have the signature bool(vertex_index_t, scalar_t, vertex_index_t).
@@ -172,25 +318,26 @@ namespace quiver
 	// has_been_visited shall have the signature bool(vertex_index_t)
 	// and shall return true iff the vertex has been visited by visitor.
 	// weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
-	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	template<dijkstra_strategy_t strategy = always_insert, typename heap_policy_t = dijkstra_default_heap_policy<strategy>, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
 	bool dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
 	{
-		return detail::basic_dijkstra<detail::bind_dijkstra_queue_entry_t<detail::dijkstra_predecessor_t>::templ, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, start, visitor, has_been_visited, weight_invokable);
+		return detail::basic_dijkstra<strategy, heap_policy_t, detail::bind_dijkstra_queue_entry_t<detail::dijkstra_predecessor_t>::templ, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, start, visitor, has_been_visited, weight_invokable);
 	}
-	template<typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
+	template<dijkstra_strategy_t strategy = always_insert, typename heap_policy_t = dijkstra_default_heap_policy<strategy>, typename graph_t, typename visitor_t, visited_predicate has_been_visited_t, typename weight_invokable_t>
 	bool dijkstra_shortest_path(graph_t& graph, vertex_index_t start, visitor_t visitor, has_been_visited_t has_been_visited, weight_invokable_t weight_invokable)
 	{
-		return dijkstra_shortest_path<graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, std::ranges::single_view(start), visitor, has_been_visited, weight_invokable);
+		return dijkstra_shortest_path<strategy, heap_policy_t, graph_t, visitor_t, has_been_visited_t, weight_invokable_t>(graph, std::ranges::single_view(start), visitor, has_been_visited, weight_invokable);
 	}
 	// Return type is a map from vertex index to (distance from start, predecessor)
-	template<typename graph_t, typename weight_invokable_t>
+	template<dijkstra_strategy_t strategy = always_insert, typename heap_policy_t = dijkstra_default_heap_policy<strategy>, typename graph_t, typename weight_invokable_t>
 	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, weight_invokable_t weight_invokable)
 	{
 		using out_edge_t = typename graph_t::out_edge_t;
 		using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
+		using index_t = typename graph_t::vertex_index_type;
 
-		constexpr vertex_index_t no_predecessor = ~vertex_index_t{};
-		std::vector<std::pair<scalar_t, vertex_index_t>> result(graph.V.size(), { inf<scalar_t>, no_predecessor });
+		constexpr index_t no_predecessor = ~index_t{};
+		std::vector<std::pair<scalar_t, index_t>> result(graph.V.size(), { inf<scalar_t>, no_predecessor });
 		auto visitor = [&result](vertex_index_t vertex, scalar_t distance, vertex_index_t predecessor) -> bool {
 			result[vertex] = { distance, predecessor };
 			//	maybe break; if vertex is an end node
@@ -199,28 +346,106 @@ namespace quiver
 		auto has_been_visited = [&result](vertex_index_t index){
 			return result[index].second != no_predecessor;
 		};
-		dijkstra_shortest_path<graph_t, decltype(visitor), decltype(has_been_visited), weight_invokable_t>(graph, start, std::move(visitor), std::move(has_been_visited), weight_invokable);
+		dijkstra_shortest_path<strategy, heap_policy_t, graph_t, decltype(visitor), decltype(has_been_visited), weight_invokable_t>(graph, start, std::move(visitor), std::move(has_been_visited), weight_invokable);
 		return result;
 	}
-	template<typename graph_t, typename weight_invokable_t>
+	template<dijkstra_strategy_t strategy = always_insert, typename heap_policy_t = dijkstra_default_heap_policy<strategy>, typename graph_t, typename weight_invokable_t>
 	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, vertex_index_t start, weight_invokable_t weight_invokable)
 	{
-		return dijkstra_shortest_path<graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), weight_invokable);
+		return dijkstra_shortest_path<strategy, heap_policy_t, graph_t, weight_invokable_t>(graph, std::ranges::single_view(start), weight_invokable);
 	}
-	template<typename graph_t>
+	template<dijkstra_strategy_t strategy = always_insert, typename heap_policy_t = dijkstra_default_heap_policy<strategy>, typename graph_t>
 	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
 	{
-		return dijkstra_shortest_path(graph, start, dijkstra_default_weight_invokable<graph_t>());
+		return dijkstra_shortest_path<strategy, heap_policy_t>(graph, start, dijkstra_default_weight_invokable<graph_t>());
 	}
-	template<typename graph_t>
+	template<dijkstra_strategy_t strategy = always_insert, typename heap_policy_t = dijkstra_default_heap_policy<strategy>, typename graph_t>
 	[[nodiscard]] auto dijkstra_shortest_path(graph_t& graph, vertex_index_t start)
 	{
-		return dijkstra_shortest_path<graph_t>(graph, std::ranges::single_view(start));
+		return dijkstra_shortest_path<strategy, heap_policy_t, graph_t>(graph, std::ranges::single_view(start));
+	}
+
+	// Searches with the buffers of workspace, see search_workspace. The queue is workspace.heap().
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t, typename weight_invokable_t>
+	bool dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return detail::workspace_dijkstra(graph, start, visitor, workspace, weight_invokable);
+	}
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t, typename weight_invokable_t>
+	bool dijkstra_shortest_path(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return detail::workspace_dijkstra(graph, std::ranges::single_view(start), visitor, workspace, weight_invokable);
+	}
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	bool dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return detail::workspace_dijkstra(graph, start, visitor, workspace, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t, typename visitor_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	bool dijkstra_shortest_path(graph_t& graph, vertex_index_t start, visitor_t visitor, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return detail::workspace_dijkstra(graph, std::ranges::single_view(start), visitor, workspace, dijkstra_default_weight_invokable<graph_t>());
+	}
+	// The results are left in workspace.
+	template<typename graph_t, typename scalar_t, typename index_t, typename heap_policy_t, typename weight_invokable_t>
+	search_workspace<scalar_t, index_t, heap_policy_t> const& dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, search_workspace<scalar_t, index_t, heap_policy_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		auto visitor = [](vertex_index_t vertex, scalar_t const& distance, vertex_index_t predecessor) constexpr -> bool {
+			(void)vertex; // -Wunused-parameter
+			(void)distance; // -Wunused-parameter
+			(void)predecessor; // -Wunused-parameter
+			return false;
+		};
+		detail::workspace_dijkstra(graph, start, visitor, workspace, weight_invokable);
+		return workspace;
+	}
+	template<typename graph_t, typename scalar_t, typename index_t, typename heap_policy_t, typename weight_invokable_t>
+	search_workspace<scalar_t, index_t, heap_policy_t> const& dijkstra_shortest_path(graph_t& graph, vertex_index_t start, search_workspace<scalar_t, index_t, heap_policy_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return dijkstra_shortest_path(graph, std::ranges::single_view(start), workspace, weight_invokable);
+	}
+	template<typename graph_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	search_workspace<scalar_t, index_t, heap_policy_t> const& dijkstra_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return dijkstra_shortest_path(graph, start, workspace, dijkstra_default_weight_invokable<graph_t>());
+	}
+	template<typename graph_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	search_workspace<scalar_t, index_t, heap_policy_t> const& dijkstra_shortest_path(graph_t& graph, vertex_index_t start, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return dijkstra_shortest_path(graph, std::ranges::single_view(start), workspace);
+	}
+
+	// Searches from start until every vertex of targets has been visited. start and targets may both be a
+	// single vertex or a range of vertices. Returns the search_path_t to targets if it is a vertex and a
+	// vector of them, in the order of targets, if it is a range. Only the vertices which are closer to start
+	// than the farthest target are explored; the overloads without a workspace allocate one of size V.
+	template<typename graph_t, typename targets_t, typename scalar_t, typename index_t, typename heap_policy_t, typename weight_invokable_t>
+	[[nodiscard]] auto dijkstra_shortest_path_to(graph_t& graph, auto const& start, targets_t const& targets, search_workspace<scalar_t, index_t, heap_policy_t>& workspace, weight_invokable_t weight_invokable)
+	{
+		return detail::search_to(targets, workspace, [&](auto visitor) {
+			detail::workspace_dijkstra(graph, detail::as_vertex_range(start), visitor, workspace, weight_invokable);
+		});
+	}
+	template<typename graph_t, typename targets_t, typename scalar_t, typename index_t, typename heap_policy_t>
+	[[nodiscard]] auto dijkstra_shortest_path_to(graph_t& graph, auto const& start, targets_t const& targets, search_workspace<scalar_t, index_t, heap_policy_t>& workspace)
+	{
+		return dijkstra_shortest_path_to(graph, start, targets, workspace, dijkstra_default_weight_invokable<graph_t>());
 	}
+	template<typename graph_t, typename targets_t, typename weight_invokable_t>
+	[[nodiscard]] auto dijkstra_shortest_path_to(graph_t& graph, auto const& start, targets_t const& targets, weight_invokable_t weight_invokable)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_t = std::invoke_result_t<weight_invokable_t, vertex_index_t, const out_edge_t>;
 
-	// TODO: overloads with end node(s)
+		search_workspace<scalar_t, typename graph_t::vertex_index_type> workspace(graph);
+		return dijkstra_shortest_path_to(graph, start, targets, workspace, weight_invokable);
+	}
+	template<typename graph_t, typename targets_t>
+	[[nodiscard]] auto dijkstra_shortest_path_to(graph_t& graph, auto const& start, targets_t const& targets)
+	{
+		return dijkstra_shortest_path_to(graph, start, targets, dijkstra_default_weight_invokable<graph_t>());
+	}
 
-	// if implemented, implement them for bfs_shortest_path too
 	// TODO: out iterator overloads for the *shortest_path variant
 	// TODO: maybe return the same vertex container as the graph. how would the current implementation even work if the vertex data structure were e.g. a hash map?
 	// TODO: maybe offer the functionality to store the result within the vertex data
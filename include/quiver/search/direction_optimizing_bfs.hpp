@@ -0,0 +1,129 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_DIRECTION_OPTIMIZING_BFS_HPP_INCLUDED
+#define QUIVER_SEARCH_DIRECTION_OPTIMIZING_BFS_HPP_INCLUDED
+
+#include <quiver/search/bfs.hpp>
+#include <quiver/reverse_index.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <ranges>
+#include <vector>
+#include <utility>
+#include <cassert>
+#include <cstddef>
+
+namespace quiver
+{
+	// Beamer's heuristic: a growing frontier is expanded bottom-up, i.e. by letting every unvisited vertex look
+	// for a parent in the frontier, once the frontier has more than 1 / alpha as many out-edges as the unvisited
+	// vertices have in-edges. A shrinking frontier is expanded top-down again once it holds less than 1 / beta
+	// of the vertices. A large alpha thus keeps the search top-down, a large beta keeps it bottom-up.
+	struct direction_heuristic_t
+	{
+		double alpha = 14;
+		double beta = 24;
+	};
+
+	// Return type is a map from vertex index to (distance from start, predecessor).
+	// The distances equal those of bfs_shortest_path. The predecessors form a shortest path tree as well,
+	// but vertices expanded bottom-up take their first in-neighbor from the frontier as predecessor.
+	// reverse shall be the reverse_index of graph.
+	template<typename graph_t>
+	[[nodiscard]] auto direction_optimizing_bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, reverse_index<std::remove_const_t<graph_t>> const& reverse, direction_heuristic_t heuristic = {})
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using index_t = typename graph_t::vertex_index_type;
+
+		assert(reverse.size() == graph.V.size());
+		constexpr index_t no_predecessor = ~index_t{};
+		std::vector<std::pair<bfs_path_length_t, index_t>> result(graph.V.size(), { inf<bfs_path_length_t>, no_predecessor });
+		std::vector<bool> visited(graph.V.size(), false);
+		std::vector<bool> in_frontier(graph.V.size(), false);
+
+		std::vector<index_t> frontier, next;
+		for(vertex_index_t index : start) {
+			assert(index < graph.V.size());
+			if(!visited[index]) {
+				visited[index] = true;
+				frontier.push_back(static_cast<index_t>(index));
+				result[index] = { 0, static_cast<index_t>(index) };
+			}
+		}
+
+		// the in-edges of the unvisited vertices
+		std::size_t unvisited_edges = reverse.edges();
+		for(index_t index : frontier)
+			unvisited_edges -= reverse.in_degree(index);
+
+		bool bottom_up = false;
+		std::size_t previous_size = 0;
+		for(bfs_path_length_t level = 1; !frontier.empty(); ++level) {
+			const bool growing = frontier.size() > previous_size;
+			if(!bottom_up) {
+				std::size_t frontier_edges = 0;
+				for(index_t index : frontier)
+					frontier_edges += graph.V[index].out_degree();
+				bottom_up = growing && static_cast<double>(frontier_edges) * heuristic.alpha > static_cast<double>(unvisited_edges);
+			} else {
+				bottom_up = growing || static_cast<double>(frontier.size()) * heuristic.beta >= static_cast<double>(graph.V.size());
+			}
+			previous_size = frontier.size();
+
+			next.clear();
+			if(bottom_up) {
+				for(index_t index : frontier)
+					in_frontier[index] = true;
+				for(vertex_index_t to = 0; to < graph.V.size(); ++to) {
+					if(visited[to])
+						continue;
+					for(index_t from : reverse.sources(to))
+						if(in_frontier[from]) {
+							visited[to] = true;
+							result[to] = { level, from };
+							next.push_back(static_cast<index_t>(to));
+							break;
+						}
+				}
+				for(index_t index : frontier)
+					in_frontier[index] = false;
+			} else {
+				for(index_t from : frontier)
+					for(out_edge_t const& edge : graph.V[from].out_edges)
+						if(!visited[edge.to]) {
+							visited[edge.to] = true;
+							result[edge.to] = { level, from };
+							next.push_back(static_cast<index_t>(edge.to));
+						}
+			}
+
+			for(index_t index : next)
+				unvisited_edges -= reverse.in_degree(index);
+			frontier.swap(next);
+		}
+		return result;
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto direction_optimizing_bfs_shortest_path(graph_t& graph, vertex_index_t start, reverse_index<std::remove_const_t<graph_t>> const& reverse, direction_heuristic_t heuristic = {})
+	{
+		return direction_optimizing_bfs_shortest_path<graph_t>(graph, std::ranges::single_view(start), reverse, heuristic);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto direction_optimizing_bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, direction_heuristic_t heuristic = {})
+	{
+		const reverse_index<std::remove_const_t<graph_t>> reverse(graph);
+		return direction_optimizing_bfs_shortest_path<graph_t>(graph, start, reverse, heuristic);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto direction_optimizing_bfs_shortest_path(graph_t& graph, vertex_index_t start, direction_heuristic_t heuristic = {})
+	{
+		return direction_optimizing_bfs_shortest_path<graph_t>(graph, std::ranges::single_view(start), heuristic);
+	}
+}
+
+#endif // !QUIVER_SEARCH_DIRECTION_OPTIMIZING_BFS_HPP_INCLUDED
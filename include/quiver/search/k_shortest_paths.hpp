@@ -0,0 +1,235 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_K_SHORTEST_PATHS_HPP_INCLUDED
+#define QUIVER_SEARCH_K_SHORTEST_PATHS_HPP_INCLUDED
+
+#include <quiver/search/dijkstra.hpp>
+#include <quiver/search/workspace.hpp>
+#include <quiver/typedefs.hpp>
+#include <quiver/util.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+#include <set>
+#include <cassert>
+#include <cstddef>
+
+namespace quiver
+{
+	namespace detail
+	{
+		template<typename scalar_t>
+		struct k_shortest_paths_candidate_t
+		{
+			search_path_t<scalar_t> path;
+			// the index of the vertex of path at which it deviates from the path it has been derived from
+			std::size_t spur;
+		};
+		// orders the candidates such that the shortest one is the top of a max heap
+		template<typename scalar_t>
+		[[nodiscard]] bool operator<(k_shortest_paths_candidate_t<scalar_t> const& lhs, k_shortest_paths_candidate_t<scalar_t> const& rhs)
+		{
+			if(lhs.path.distance != rhs.path.distance)
+				return rhs.path.distance < lhs.path.distance;
+			return rhs.path.vertices < lhs.path.vertices;
+		}
+	}
+
+	// Enumerates the loopless paths from start to target by increasing length, by Yen's algorithm: every call of
+	// next returns the next one, or a path which hasn't been reached once there are no more. Each path after the
+	// first is found among the deviations of the previous ones; a deviation keeps a prefix of a path, the root,
+	// and runs a search from its last vertex, the spur, which must neither revisit the root nor leave the spur
+	// by an edge by which a previous path with the same root does. These spur searches share one
+	// search_workspace and stop as soon as they reach target, so the i-th path costs at most as many searches as
+	// the (i-1)-th has vertices, and only the paths which are asked for are computed.
+	// Weights must not be negative. weight_invokable shall have the signature scalar_t(vertex_index_t, out_edge_t).
+	template<typename graph_t, typename weight_invokable_t>
+	class k_shortest_paths_t
+	{
+	public:
+		using out_edge_t = typename graph_t::out_edge_t;
+		using scalar_type = std::invoke_result_t<weight_invokable_t, vertex_index_t, out_edge_t const>;
+		using vertex_index_type = typename graph_t::vertex_index_type;
+		using path_type = search_path_t<scalar_type>;
+		using workspace_type = search_workspace<scalar_type, vertex_index_type>;
+
+	private:
+		using candidate_t = detail::k_shortest_paths_candidate_t<scalar_type>;
+		using queue_entry_t = typename workspace_type::queue_entry_type;
+
+		graph_t& m_graph;
+		weight_invokable_t m_weight_invokable;
+		vertex_index_t m_start;
+		vertex_index_t m_target;
+		workspace_type m_workspace;
+		// the paths returned so far and the spur index of each
+		std::vector<candidate_t> m_paths;
+		// a heap of the deviations which haven't been returned yet
+		std::vector<candidate_t> m_candidates;
+		// the vertices of every path in m_paths and m_candidates
+		std::set<std::vector<vertex_index_t>> m_known;
+		// the vertices which the current spur search must not visit
+		std::vector<vertex_index_t> m_blocked_vertices;
+		// the successors of the spur which the current spur search must not go to
+		std::vector<vertex_index_t> m_blocked_edges;
+		bool m_started = false;
+		// the number of paths in m_paths whose deviations have been added to m_candidates
+		std::size_t m_deviated = 0;
+
+		// the weight of the lightest edge from -> to
+		scalar_type edge_weight(vertex_index_t from, vertex_index_t to) const
+		{
+			scalar_type result = inf<scalar_type>;
+			for(out_edge_t const& edge : m_graph.V[from].out_edges)
+				if(edge.to == to)
+					result = std::min(result, scalar_type(m_weight_invokable(from, edge)));
+			assert(result != inf<scalar_type>);
+			return result;
+		}
+
+		// dijkstra from spur to m_target which avoids m_blocked_vertices and m_blocked_edges
+		bool spur_search(vertex_index_t spur)
+		{
+			m_workspace.begin(m_graph.V.size());
+			for(vertex_index_t vertex : m_blocked_vertices) {
+				m_workspace.discover(vertex, scalar_type(0), static_cast<vertex_index_type>(vertex));
+				m_workspace.visit(vertex);
+			}
+			auto& queue = m_workspace.heap();
+			m_workspace.discover(spur, scalar_type(0), static_cast<vertex_index_type>(spur));
+			queue.push(queue_entry_t{ static_cast<vertex_index_type>(spur), scalar_type(0) });
+			while(!queue.empty()) {
+				const queue_entry_t top = queue.extract_top();
+				if(m_workspace.visited(top.index))
+					continue;
+				m_workspace.visit(top.index);
+				if(top.index == m_target)
+					return true;
+				for(out_edge_t const& edge : m_graph.V[top.index].out_edges)
+					if(!m_workspace.visited(edge.to)) {
+						if(top.index == spur && std::find(m_blocked_edges.begin(), m_blocked_edges.end(), vertex_index_t(edge.to)) != m_blocked_edges.end())
+							continue;
+						const scalar_type distance = top.distance + scalar_type(m_weight_invokable(vertex_index_t(top.index), edge));
+						assert(distance >= top.distance);
+						if(m_workspace.relax(edge.to, distance, top.index))
+							queue.push(queue_entry_t{ static_cast<vertex_index_type>(edge.to), distance });
+					}
+			}
+			return false;
+		}
+
+		void push_candidate(candidate_t&& candidate)
+		{
+			if(!m_known.insert(candidate.path.vertices).second)
+				return;
+			m_candidates.push_back(std::move(candidate));
+			std::push_heap(m_candidates.begin(), m_candidates.end());
+		}
+
+		// adds the deviations of last to the candidates
+		void deviate(candidate_t const& last)
+		{
+			std::vector<vertex_index_t> const& vertices = last.path.vertices;
+			// deviations at a vertex before last.spur have been found from the path last was derived from
+			scalar_type root_distance = scalar_type(0);
+			for(std::size_t i = 0; i < last.spur; ++i)
+				root_distance += edge_weight(vertices[i], vertices[i + 1]);
+
+			for(std::size_t i = last.spur; i + 1 < vertices.size(); ++i) {
+				const vertex_index_t spur = vertices[i];
+				m_blocked_vertices.assign(vertices.begin(), vertices.begin() + i);
+				m_blocked_edges.clear();
+				for(candidate_t const& previous : m_paths) {
+					std::vector<vertex_index_t> const& other = previous.path.vertices;
+					if(other.size() > i + 1 && std::equal(vertices.begin(), vertices.begin() + i + 1, other.begin()))
+						m_blocked_edges.push_back(other[i + 1]);
+				}
+
+				if(spur_search(spur)) {
+					path_type spur_path = m_workspace.path_to(m_target);
+					candidate_t candidate{ path_type{ root_distance + spur_path.distance, std::vector<vertex_index_t>(vertices.begin(), vertices.begin() + i) }, i };
+					candidate.path.vertices.insert(candidate.path.vertices.end(), spur_path.vertices.begin(), spur_path.vertices.end());
+					push_candidate(std::move(candidate));
+				}
+				root_distance += edge_weight(spur, vertices[i + 1]);
+			}
+		}
+
+	public:
+		k_shortest_paths_t(graph_t& graph, vertex_index_t start, vertex_index_t target, weight_invokable_t weight_invokable)
+		: m_graph(graph)
+		, m_weight_invokable(std::move(weight_invokable))
+		, m_start(start)
+		, m_target(target)
+		, m_workspace(graph)
+		{
+			assert(start < graph.V.size());
+			assert(target < graph.V.size());
+		}
+		k_shortest_paths_t(graph_t& graph, vertex_index_t start, vertex_index_t target) requires std::is_same_v<weight_invokable_t, decltype(dijkstra_default_weight_invokable<graph_t>())>
+		: k_shortest_paths_t(graph, start, target, dijkstra_default_weight_invokable<graph_t>())
+		{
+		}
+
+		// the next shortest path, or an unreached one if there is none
+		[[nodiscard]] path_type next()
+		{
+			if(!m_started) {
+				m_started = true;
+				if(spur_search(m_start)) {
+					m_paths.push_back(candidate_t{ m_workspace.path_to(m_target), 0 });
+					m_known.insert(m_paths.back().path.vertices);
+					return m_paths.back().path;
+				}
+			}
+			for(; m_deviated < m_paths.size(); ++m_deviated)
+				deviate(m_paths[m_deviated]);
+			if(m_candidates.empty())
+				return path_type{};
+			std::pop_heap(m_candidates.begin(), m_candidates.end());
+			m_paths.push_back(std::move(m_candidates.back()));
+			m_candidates.pop_back();
+			return m_paths.back().path;
+		}
+
+		// the number of paths next has returned
+		[[nodiscard]] std::size_t size() const noexcept
+		{
+			return m_paths.size();
+		}
+	};
+
+	template<typename graph_t, typename weight_invokable_t>
+	k_shortest_paths_t(graph_t&, vertex_index_t, vertex_index_t, weight_invokable_t) -> k_shortest_paths_t<graph_t, weight_invokable_t>;
+	template<typename graph_t>
+	k_shortest_paths_t(graph_t&, vertex_index_t, vertex_index_t) -> k_shortest_paths_t<graph_t, decltype(dijkstra_default_weight_invokable<graph_t>())>;
+
+	// Returns the k shortest loopless paths from start to target by increasing length, fewer if there aren't as many.
+	template<typename graph_t, typename weight_invokable_t>
+	[[nodiscard]] auto k_shortest_paths(graph_t& graph, vertex_index_t start, vertex_index_t target, std::size_t k, weight_invokable_t weight_invokable)
+	{
+		k_shortest_paths_t generator(graph, start, target, weight_invokable);
+		std::vector<typename decltype(generator)::path_type> result;
+		while(result.size() < k) {
+			auto path = generator.next();
+			if(!path.reached())
+				break;
+			result.push_back(std::move(path));
+		}
+		return result;
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto k_shortest_paths(graph_t& graph, vertex_index_t start, vertex_index_t target, std::size_t k)
+	{
+		return k_shortest_paths(graph, start, target, k, dijkstra_default_weight_invokable<graph_t>());
+	}
+}
+
+#endif // !QUIVER_SEARCH_K_SHORTEST_PATHS_HPP_INCLUDED
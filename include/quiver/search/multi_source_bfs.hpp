@@ -0,0 +1,154 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_MULTI_SOURCE_BFS_HPP_INCLUDED
+#define QUIVER_SEARCH_MULTI_SOURCE_BFS_HPP_INCLUDED
+
+#include <quiver/thread_pool.hpp>
+#include <quiver/typedefs.hpp>
+#include <quiver/util.hpp>
+#include <algorithm>
+#include <utility>
+#include <limits>
+#include <ranges>
+#include <vector>
+#include <span>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+
+namespace quiver
+{
+	// the bits of multi_source_bfs; bit i stands for the i-th source of a batch
+	using multi_source_bfs_mask_t = std::uint64_t;
+	inline constexpr std::size_t multi_source_bfs_batch_size = std::numeric_limits<multi_source_bfs_mask_t>::digits;
+
+	namespace detail
+	{
+		// the per vertex masks of multi_source_bfs, which can be reused by consecutive batches
+		struct multi_source_bfs_buffers_t
+		{
+			// vertex -> the sources which have reached it
+			std::vector<multi_source_bfs_mask_t> seen;
+			// vertex -> the sources whose frontier it is part of
+			std::vector<multi_source_bfs_mask_t> visit;
+			// vertex -> the sources which reach it in the next level
+			std::vector<multi_source_bfs_mask_t> next;
+			std::vector<vertex_index_t> frontier;
+			std::vector<vertex_index_t> next_frontier;
+
+			void begin(std::size_t n)
+			{
+				seen.assign(n, 0);
+				visit.assign(n, 0);
+				next.assign(n, 0);
+				frontier.clear();
+				next_frontier.clear();
+			}
+		};
+
+		template<typename graph_t, typename visitor_t>
+		bool multi_source_bfs(graph_t& graph, std::ranges::input_range auto const& sources, visitor_t& visitor, multi_source_bfs_buffers_t& buffers)
+		{
+			using out_edge_t = typename graph_t::out_edge_t;
+
+			buffers.begin(graph.V.size());
+			std::size_t bit = 0;
+			for(vertex_index_t source : sources) {
+				assert(source < graph.V.size());
+				assert(bit < multi_source_bfs_batch_size);
+				const multi_source_bfs_mask_t mask = multi_source_bfs_mask_t(1) << bit++;
+				if(buffers.visit[source] == 0)
+					buffers.frontier.push_back(source);
+				buffers.visit[source] |= mask;
+				buffers.seen[source] |= mask;
+			}
+			for(vertex_index_t vertex : buffers.frontier)
+				if(visitor(vertex, bfs_path_length_t(0), std::as_const(buffers.visit[vertex])))
+					return true;
+
+			for(bfs_path_length_t level = 1; !buffers.frontier.empty(); ++level) {
+				// every adjacency list of the frontier is scanned once for all the sources
+				for(vertex_index_t vertex : buffers.frontier) {
+					const multi_source_bfs_mask_t mask = buffers.visit[vertex];
+					for(out_edge_t const& edge : graph.V[vertex].out_edges) {
+						multi_source_bfs_mask_t& next = buffers.next[edge.to];
+						if(next == 0)
+							buffers.next_frontier.push_back(edge.to);
+						next |= mask;
+					}
+					buffers.visit[vertex] = 0;
+				}
+
+				buffers.frontier.clear();
+				for(vertex_index_t vertex : buffers.next_frontier) {
+					const multi_source_bfs_mask_t reached = buffers.next[vertex] & ~buffers.seen[vertex];
+					buffers.next[vertex] = 0;
+					if(reached == 0)
+						continue;
+					buffers.seen[vertex] |= reached;
+					buffers.visit[vertex] = reached;
+					buffers.frontier.push_back(vertex);
+					if(visitor(vertex, level, reached))
+						return true;
+				}
+				buffers.next_frontier.clear();
+			}
+			return false;
+		}
+	}
+
+	// Runs a breadth first search from each of up to multi_source_bfs_batch_size sources at once. Each vertex
+	// carries a mask with a bit per source, so that the adjacency list of a vertex is scanned once per level for
+	// all the searches whose frontier it is part of, instead of once per search.
+	// visitor shall have the signature bool(vertex_index_t, bfs_path_length_t, multi_source_bfs_mask_t) and
+	// is called once per vertex and level with the mask of the sources which reach the vertex in that many steps,
+	// e.g. std::popcount of it counts them. If visitor returns true, exit the search and return true.
+	// Returns false if no visitation returned true.
+	template<typename graph_t, typename visitor_t>
+	bool multi_source_bfs(graph_t& graph, std::ranges::input_range auto const& sources, visitor_t visitor)
+	{
+		detail::multi_source_bfs_buffers_t buffers;
+		return detail::multi_source_bfs(graph, sources, visitor, buffers);
+	}
+
+	// Writes the hop distance from every vertex of sources to every vertex into distances, a row-major matrix of
+	// sources.size() x V, or inf<bfs_path_length_t> if there is no path. The sources are split into batches of
+	// multi_source_bfs_batch_size, each a multi_source_bfs, which run on the workers of pool.
+	template<typename graph_t>
+	void multi_source_bfs_distances(graph_t& graph, std::ranges::random_access_range auto const& sources, std::span<bfs_path_length_t> distances, thread_pool& pool)
+	{
+		const std::size_t n = graph.V.size();
+		const std::size_t count = std::ranges::size(sources);
+		assert(distances.size() == count * n);
+		std::fill(distances.begin(), distances.end(), inf<bfs_path_length_t>);
+
+		std::vector<detail::multi_source_bfs_buffers_t> buffers(pool.size());
+		const std::size_t batches = (count + multi_source_bfs_batch_size - 1) / multi_source_bfs_batch_size;
+		pool.parallel_for(batches, 1, [&](std::size_t worker, std::size_t begin, std::size_t end) {
+			for(std::size_t batch = begin; batch < end; ++batch) {
+				const std::size_t first = batch * multi_source_bfs_batch_size;
+				const auto batch_sources = std::ranges::subrange(std::ranges::begin(sources) + first, std::ranges::begin(sources) + std::min(count, first + multi_source_bfs_batch_size));
+				auto visitor = [&](vertex_index_t vertex, bfs_path_length_t level, multi_source_bfs_mask_t reached) -> bool {
+					for(; reached != 0; reached &= reached - 1)
+						distances[(first + std::countr_zero(reached)) * n + vertex] = level;
+					return false;
+				};
+				detail::multi_source_bfs(graph, batch_sources, visitor, buffers[worker]);
+			}
+		});
+	}
+	template<typename graph_t>
+	void multi_source_bfs_distances(graph_t& graph, std::ranges::random_access_range auto const& sources, std::span<bfs_path_length_t> distances)
+	{
+		thread_pool pool;
+		multi_source_bfs_distances(graph, sources, distances, pool);
+	}
+}
+
+#endif // !QUIVER_SEARCH_MULTI_SOURCE_BFS_HPP_INCLUDED
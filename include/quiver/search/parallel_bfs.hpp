@@ -0,0 +1,121 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_PARALLEL_BFS_HPP_INCLUDED
+#define QUIVER_SEARCH_PARALLEL_BFS_HPP_INCLUDED
+
+#include <quiver/search/visitation_table.hpp>
+#include <quiver/search/bfs.hpp>
+#include <quiver/thread_pool.hpp>
+#include <quiver/util.hpp>
+#include <algorithm>
+#include <atomic>
+#include <ranges>
+#include <vector>
+#include <utility>
+#include <cassert>
+#include <cstddef>
+
+namespace quiver
+{
+	namespace detail
+	{
+		// the number of frontier vertices per parallel_for chunk
+		inline std::size_t parallel_bfs_grain(std::size_t frontier_size, std::size_t workers) noexcept
+		{
+			return std::max<std::size_t>(64, frontier_size / (8 * workers));
+		}
+	}
+
+	// Return type is a map from vertex index to (distance from start, predecessor), equal to that of bfs_shortest_path.
+	// The frontier is expanded level by level by the workers of pool in two passes: the first one finds, for
+	// every newly reached vertex, the earliest frontier vertex with an edge to it, which is the predecessor the
+	// sequential search would pick. The second one lets that vertex claim it, in frontier order, such that the
+	// next frontier is in the same order as the queue of the sequential search.
+	template<typename graph_t>
+	[[nodiscard]] auto parallel_bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start, thread_pool& pool)
+	{
+		using out_edge_t = typename graph_t::out_edge_t;
+		using index_t = typename graph_t::vertex_index_type;
+
+		constexpr index_t no_predecessor = ~index_t{};
+		std::vector<std::pair<bfs_path_length_t, index_t>> result(graph.V.size(), { inf<bfs_path_length_t>, no_predecessor });
+		atomic_visitation_table_t visited(graph);
+		// vertex -> the least frontier position of its predecessors, stored complemented so that 0 means none
+		std::vector<std::atomic<index_t>> discoverer(graph.V.size());
+
+		std::vector<index_t> frontier;
+		for(vertex_index_t index : start) {
+			assert(index < graph.V.size());
+			if(!visited.test_and_set(index)) {
+				frontier.push_back(static_cast<index_t>(index));
+				result[index] = { 0, static_cast<index_t>(index) };
+			}
+		}
+
+		std::vector<std::vector<index_t>> chunk_frontiers;
+		for(bfs_path_length_t level = 1; !frontier.empty(); ++level) {
+			const std::size_t grain = detail::parallel_bfs_grain(frontier.size(), pool.size());
+
+			pool.parallel_for(frontier.size(), grain, [&](std::size_t worker, std::size_t begin, std::size_t end) {
+				(void)worker; // -Wunused-parameter
+				for(std::size_t position = begin; position < end; ++position) {
+					const index_t key = ~static_cast<index_t>(position);
+					for(out_edge_t const& edge : graph.V[frontier[position]].out_edges) {
+						if(visited(edge.to))
+							continue;
+						std::atomic<index_t>& slot = discoverer[edge.to];
+						for(index_t current = slot.load(std::memory_order_relaxed); current < key;)
+							if(slot.compare_exchange_weak(current, key, std::memory_order_relaxed))
+								break;
+					}
+				}
+			});
+
+			const std::size_t chunks = (frontier.size() + grain - 1) / grain;
+			if(chunk_frontiers.size() < chunks)
+				chunk_frontiers.resize(chunks);
+			pool.parallel_for(frontier.size(), grain, [&](std::size_t worker, std::size_t begin, std::size_t end) {
+				(void)worker; // -Wunused-parameter
+				std::vector<index_t>& next = chunk_frontiers[begin / grain];
+				next.clear();
+				for(std::size_t position = begin; position < end; ++position) {
+					const index_t key = ~static_cast<index_t>(position);
+					const index_t from = frontier[position];
+					for(out_edge_t const& edge : graph.V[from].out_edges)
+						if(discoverer[edge.to].load(std::memory_order_relaxed) == key && !visited.test_and_set(edge.to)) {
+							result[edge.to] = { level, from };
+							next.push_back(static_cast<index_t>(edge.to));
+						}
+				}
+			});
+
+			frontier.clear();
+			for(std::size_t chunk = 0; chunk < chunks; ++chunk)
+				frontier.insert(frontier.end(), chunk_frontiers[chunk].begin(), chunk_frontiers[chunk].end());
+		}
+		return result;
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto parallel_bfs_shortest_path(graph_t& graph, vertex_index_t start, thread_pool& pool)
+	{
+		return parallel_bfs_shortest_path<graph_t>(graph, std::ranges::single_view(start), pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto parallel_bfs_shortest_path(graph_t& graph, std::ranges::input_range auto const& start)
+	{
+		thread_pool pool;
+		return parallel_bfs_shortest_path<graph_t>(graph, start, pool);
+	}
+	template<typename graph_t>
+	[[nodiscard]] auto parallel_bfs_shortest_path(graph_t& graph, vertex_index_t start)
+	{
+		return parallel_bfs_shortest_path<graph_t>(graph, std::ranges::single_view(start));
+	}
+}
+
+#endif // !QUIVER_SEARCH_PARALLEL_BFS_HPP_INCLUDED
@@ -10,8 +10,10 @@
 
 #include <quiver/typedefs.hpp>
 #include <vector>
+#include <atomic>
 #include <cassert>
 #include <concepts>
+#include <cstdint>
 
 namespace quiver
 {
@@ -54,6 +56,47 @@ namespace quiver
 		}
 	};
 
+	// A bitmap of visited vertices that may be set from several threads at once.
+	class atomic_visitation_table_t
+	{
+		using word_t = std::uint64_t;
+		static constexpr std::size_t word_bits = 64;
+
+		std::vector<std::atomic<word_t>> m_visited;
+		std::size_t m_size;
+
+	public:
+		[[nodiscard]] explicit atomic_visitation_table_t(std::size_t n)
+		: m_visited((n + word_bits - 1) / word_bits), m_size(n)
+		{
+		}
+		template<typename graph_t>
+		[[nodiscard]] explicit atomic_visitation_table_t(graph_t const& graph)
+		: atomic_visitation_table_t(graph.V.size())
+		{
+		}
+
+		atomic_visitation_table_t(atomic_visitation_table_t const& rhs) = delete;
+		atomic_visitation_table_t(atomic_visitation_table_t&& rhs) = delete;
+
+		void set(vertex_index_t index) noexcept
+		{
+			test_and_set(index);
+		}
+		// returns whether index had already been set; exactly one of several concurrent callers gets false
+		bool test_and_set(vertex_index_t index) noexcept
+		{
+			assert(index < m_size);
+			const word_t mask = word_t{ 1 } << index % word_bits;
+			return m_visited[index / word_bits].fetch_or(mask, std::memory_order_relaxed) & mask;
+		}
+		[[nodiscard]] bool operator()(vertex_index_t index) const noexcept
+		{
+			assert(index < m_size);
+			return m_visited[index / word_bits].load(std::memory_order_relaxed) >> index % word_bits & 1;
+		}
+	};
+
 	template<typename T>
 	concept visited_predicate = std::predicate<T, vertex_index_t>;
 }
@@ -0,0 +1,257 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_SEARCH_WORKSPACE_HPP_INCLUDED
+#define QUIVER_SEARCH_WORKSPACE_HPP_INCLUDED
+
+#include <quiver/typedefs.hpp>
+#include <quiver/heaps.hpp>
+#include <quiver/util.hpp>
+#include <algorithm>
+#include <limits>
+#include <ranges>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <cstddef>
+
+namespace quiver
+{
+	// A path found by a search: its vertices from the start to the target and its length,
+	// or no vertices and a distance of inf<scalar_t> if the target has not been reached.
+	template<typename scalar_t>
+	struct search_path_t
+	{
+		scalar_t distance = inf<scalar_t>;
+		std::vector<vertex_index_t> vertices;
+
+		[[nodiscard]] bool reached() const noexcept
+		{
+			return !vertices.empty();
+		}
+	};
+
+	namespace detail
+	{
+		// lets the searches accept a single vertex wherever they accept a range of vertices
+		[[nodiscard]] constexpr auto const& as_vertex_range(std::ranges::input_range auto const& range) noexcept
+		{
+			return range;
+		}
+		[[nodiscard]] constexpr auto as_vertex_range(vertex_index_t vertex) noexcept
+		{
+			return std::ranges::single_view(vertex);
+		}
+
+		// the distinct targets of a search which ends once all of them have been visited
+		class pending_targets_t
+		{
+			std::vector<vertex_index_t> m_targets;
+			std::size_t m_remaining;
+
+		public:
+			explicit pending_targets_t(std::ranges::input_range auto const& targets)
+			{
+				for(vertex_index_t target : targets)
+					m_targets.push_back(target);
+				std::sort(m_targets.begin(), m_targets.end());
+				m_targets.erase(std::unique(m_targets.begin(), m_targets.end()), m_targets.end());
+				m_remaining = m_targets.size();
+			}
+
+			[[nodiscard]] bool empty() const noexcept
+			{
+				return m_remaining == 0;
+			}
+			// returns true iff index was the last pending target
+			bool settle(vertex_index_t index) noexcept
+			{
+				return std::binary_search(m_targets.begin(), m_targets.end(), index) && --m_remaining == 0;
+			}
+		};
+
+		template<typename scalar_t, typename index_t>
+		struct search_workspace_entry_t
+		{
+			index_t index;
+			scalar_t distance;
+		};
+		template<typename scalar_t, typename index_t>
+		[[nodiscard]] constexpr bool operator<(search_workspace_entry_t<scalar_t, index_t> const& lhs, search_workspace_entry_t<scalar_t, index_t> const& rhs)
+		{
+			return lhs.distance < rhs.distance;
+		}
+	}
+
+	// The buffers of the search algorithms, to be reused by consecutive searches such that they don't allocate once
+	// the buffers have grown to the size of the graph. Every vertex carries a stamp which tells whether it has been
+	// discovered or visited by the current search. Each search raises the base of the stamps, which invalidates
+	// all the stamps of the previous search in O(1), instead of refilling V-sized tables.
+	// After a *_shortest_path search, the results can be read through reached, distance and predecessor.
+	template<typename scalar_t = bfs_path_length_t, typename index_t = vertex_index_t, typename heap_policy_t = binary_heap_policy>
+	class search_workspace
+	{
+	public:
+		using scalar_type = scalar_t;
+		using vertex_index_type = index_t;
+		using queue_entry_type = detail::search_workspace_entry_t<scalar_t, index_t>;
+		using heap_type = typename heap_policy_t::template templ<queue_entry_type>;
+
+	private:
+		using stamp_t = std::uint32_t;
+
+		// stamp == m_base: discovered, stamp == m_base + 1: visited, anything less: untouched
+		struct slot_t
+		{
+			stamp_t stamp = 0;
+			index_t predecessor;
+			scalar_t distance;
+		};
+
+		std::vector<slot_t> m_slots;
+		stamp_t m_base = 0;
+		std::vector<index_t> m_indices;
+		heap_type m_heap;
+
+	public:
+		search_workspace()
+		{
+		}
+		[[nodiscard]] explicit search_workspace(std::size_t n)
+		: m_slots(n)
+		{
+			m_indices.reserve(n);
+		}
+		template<typename graph_t>
+		[[nodiscard]] explicit search_workspace(graph_t const& graph)
+		: search_workspace(graph.V.size())
+		{
+		}
+
+		// Invalidates the results of the previous search and makes room for n vertices.
+		void begin(std::size_t n)
+		{
+			if(m_slots.size() < n)
+				m_slots.resize(n);
+			if(m_base >= std::numeric_limits<stamp_t>::max() - 3) {
+				for(slot_t& slot : m_slots)
+					slot.stamp = 0;
+				m_base = 0;
+			}
+			m_base += 2;
+			m_indices.clear();
+			m_heap.clear();
+		}
+
+		[[nodiscard]] bool discovered(vertex_index_t index) const noexcept
+		{
+			assert(index < m_slots.size());
+			return m_slots[index].stamp >= m_base;
+		}
+		void discover(vertex_index_t index, scalar_t distance, index_t predecessor) noexcept
+		{
+			assert(index < m_slots.size());
+			m_slots[index] = { m_base, predecessor, distance };
+		}
+		// discovers index or lowers its distance; returns whether either happened
+		bool relax(vertex_index_t index, scalar_t distance, index_t predecessor) noexcept
+		{
+			assert(!visited(index));
+			if(discovered(index) && !(distance < m_slots[index].distance))
+				return false;
+			discover(index, distance, predecessor);
+			return true;
+		}
+		[[nodiscard]] bool visited(vertex_index_t index) const noexcept
+		{
+			assert(index < m_slots.size());
+			return m_slots[index].stamp == m_base + 1;
+		}
+		void visit(vertex_index_t index) noexcept
+		{
+			assert(discovered(index));
+			m_slots[index].stamp = m_base + 1;
+		}
+
+		// whether the last search visited index
+		[[nodiscard]] bool reached(vertex_index_t index) const noexcept
+		{
+			return index < m_slots.size() && visited(index);
+		}
+		[[nodiscard]] scalar_t const& distance(vertex_index_t index) const noexcept
+		{
+			assert(discovered(index));
+			return m_slots[index].distance;
+		}
+		[[nodiscard]] index_t const& predecessor(vertex_index_t index) const noexcept
+		{
+			assert(discovered(index));
+			return m_slots[index].predecessor;
+		}
+
+		// follows the predecessors of the last search back from target
+		[[nodiscard]] search_path_t<scalar_t> path_to(vertex_index_t target) const
+		{
+			search_path_t<scalar_t> result;
+			if(!reached(target))
+				return result;
+			result.distance = distance(target);
+			for(vertex_index_t index = target;; index = predecessor(index)) {
+				result.vertices.push_back(index);
+				if(predecessor(index) == index)
+					break;
+			}
+			std::reverse(result.vertices.begin(), result.vertices.end());
+			return result;
+		}
+
+		// the queue of bfs and the stack of dfs
+		[[nodiscard]] std::vector<index_t>& indices() noexcept
+		{
+			return m_indices;
+		}
+		// the queue of dijkstra
+		[[nodiscard]] heap_type& heap() noexcept
+		{
+			return m_heap;
+		}
+	};
+
+	namespace detail
+	{
+		// search shall run a search with workspace which calls the visitor it is passed with the
+		// signature bool(vertex_index_t, scalar_t, vertex_index_t) and ends once the visitor returns true.
+		// Returns the search_path_t to targets if it is a vertex and a vector of them if it is a range.
+		template<typename targets_t, typename scalar_t, typename index_t, typename heap_policy_t, typename search_t>
+		auto search_to(targets_t const& targets, search_workspace<scalar_t, index_t, heap_policy_t>& workspace, search_t search)
+		{
+			if constexpr(std::ranges::input_range<targets_t>) {
+				pending_targets_t pending(targets);
+				if(!pending.empty())
+					search([&pending](vertex_index_t index, scalar_t const& distance, vertex_index_t predecessor) -> bool {
+						(void)distance; // -Wunused-parameter
+						(void)predecessor; // -Wunused-parameter
+						return pending.settle(index);
+					});
+				std::vector<search_path_t<scalar_t>> result;
+				for(vertex_index_t target : targets)
+					result.push_back(workspace.path_to(target));
+				return result;
+			} else {
+				const vertex_index_t target = targets;
+				search([target](vertex_index_t index, scalar_t const& distance, vertex_index_t predecessor) -> bool {
+					(void)distance; // -Wunused-parameter
+					(void)predecessor; // -Wunused-parameter
+					return index == target;
+				});
+				return workspace.path_to(target);
+			}
+		}
+	}
+}
+
+#endif // !QUIVER_SEARCH_WORKSPACE_HPP_INCLUDED
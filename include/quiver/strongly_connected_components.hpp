@@ -40,14 +40,9 @@ namespace quiver
 			}
 		};
 
-		template<
-			typename edge_properties_t,
-			typename vertex_properties_t,
-			template<typename> class out_edge_container,
-			template<typename> class vertex_container
-		>
+		template<typename graph_t>
 		void tarjan_recurse(const vertex_index_t v,
-							adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& graph,
+							graph_t const& graph,
 							tarjan_state& state)
 		{
 			state.scc_index[v] = state.current_scc_index;
@@ -80,15 +75,12 @@ namespace quiver
 		}
 	}
 
-	template<
-		typename edge_properties_t,
-		typename vertex_properties_t,
-		template<typename> class out_edge_container,
-		template<typename> class vertex_container
-	>
+	template<typename graph_t>
 	std::vector<std::size_t> // vertex [0..V] -> scc index
-	tarjan_recursive(adjacency_list<directed, edge_properties_t, vertex_properties_t, out_edge_container, vertex_container> const& graph)
+	tarjan_recursive(graph_t const& graph)
 	{
+		static_assert(is_directed_v<graph_t>, "strongly connected components exist in directed graphs");
+
 		tarjan_detail::tarjan_state state(graph.V.size());
 
 		for(vertex_index_t start_node = 0; start_node < graph.V.size(); ++start_node) {
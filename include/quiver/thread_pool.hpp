@@ -0,0 +1,139 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_THREAD_POOL_HPP_INCLUDED
+#define QUIVER_THREAD_POOL_HPP_INCLUDED
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <cassert>
+#include <cstddef>
+
+namespace quiver
+{
+	// A fixed set of workers for the parallel algorithms. The calling thread of run takes part as
+	// worker 0, so a pool of size 1 has no background threads and runs everything inline.
+	// run must not be called concurrently or from within a task.
+	class thread_pool
+	{
+		std::vector<std::thread> m_threads;
+		std::mutex m_mutex;
+		std::condition_variable m_wake;
+		std::condition_variable m_done;
+		void (*m_invoke)(void const*, std::size_t) = nullptr;
+		void const* m_task = nullptr;
+		std::size_t m_generation = 0;
+		std::size_t m_pending = 0;
+		bool m_stop = false;
+		std::exception_ptr m_exception;
+
+		void execute(std::size_t worker) noexcept
+		{
+			try {
+				m_invoke(m_task, worker);
+			} catch(...) {
+				std::lock_guard<std::mutex> lock(m_mutex);
+				if(!m_exception)
+					m_exception = std::current_exception();
+			}
+		}
+		void work(std::size_t worker)
+		{
+			std::size_t generation = 0;
+			std::unique_lock<std::mutex> lock(m_mutex);
+			for(;;) {
+				m_wake.wait(lock, [&]{ return m_stop || m_generation != generation; });
+				if(m_stop)
+					return;
+				generation = m_generation;
+				lock.unlock();
+				execute(worker);
+				lock.lock();
+				if(--m_pending == 0)
+					m_done.notify_one();
+			}
+		}
+
+	public:
+		explicit thread_pool(std::size_t size = std::thread::hardware_concurrency())
+		{
+			for(std::size_t worker = 1; worker < size; ++worker)
+				m_threads.emplace_back([this, worker]{ work(worker); });
+		}
+		thread_pool(thread_pool const&) = delete;
+		thread_pool& operator=(thread_pool const&) = delete;
+		~thread_pool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_stop = true;
+			}
+			m_wake.notify_all();
+			for(std::thread& thread : m_threads)
+				thread.join();
+		}
+
+		// the number of workers, including the calling thread
+		std::size_t size() const noexcept
+		{
+			return m_threads.size() + 1;
+		}
+
+		// Invokes task(worker) once for every worker in [0, size()) and waits for all of them.
+		// The first exception thrown by a task is rethrown.
+		template<typename task_t>
+		void run(task_t const& task)
+		{
+			if(m_threads.empty()) {
+				task(std::size_t{ 0 });
+				return;
+			}
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_invoke = [](void const* task, std::size_t worker) {
+					(*static_cast<task_t const*>(task))(worker);
+				};
+				m_task = std::addressof(task);
+				m_pending = m_threads.size();
+				++m_generation;
+			}
+			m_wake.notify_all();
+			execute(0);
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_done.wait(lock, [this]{ return m_pending == 0; });
+			if(m_exception)
+				std::rethrow_exception(std::exchange(m_exception, nullptr));
+		}
+
+		// Splits [0, count) into chunks of grain indices, which are handed out to the workers
+		// dynamically, and invokes chunk(worker, begin, end) for each of them.
+		template<typename chunk_t>
+		void parallel_for(std::size_t count, std::size_t grain, chunk_t const& chunk)
+		{
+			assert(grain != 0);
+			if(count <= grain || m_threads.empty()) {
+				for(std::size_t begin = 0; begin < count; begin += grain)
+					chunk(std::size_t{ 0 }, begin, std::min(begin + grain, count));
+				return;
+			}
+			std::atomic<std::size_t> next = 0;
+			run([&](std::size_t worker) {
+				for(std::size_t begin; (begin = next.fetch_add(grain, std::memory_order_relaxed)) < count;)
+					chunk(worker, begin, std::min(begin + grain, count));
+			});
+		}
+	};
+}
+
+#endif // !QUIVER_THREAD_POOL_HPP_INCLUDED
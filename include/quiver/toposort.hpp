@@ -24,7 +24,7 @@ namespace quiver
 		for(auto const& vert : graph.V)
 			for(auto const& out_edge : vert.out_edges)
 				++in_deg[out_edge.to];
-		std::vector<vertex_index_t> starts;
+		std::vector<typename graph_t::vertex_index_type> starts;
 		for(vertex_index_t i = 0; i < graph.V.size(); ++i)
 			if(in_deg[i] == 0)
 				starts.emplace_back(i);
@@ -13,7 +13,11 @@
 
 namespace quiver
 {
+	// The type in which vertex indices are passed around. Graphs may store their indices in a narrower
+	// unsigned type (see the index_t template parameter of adjacency_list) to save memory.
 	using vertex_index_t = std::size_t;
+	// The number of edges on an unweighted path, as reported by the breadth first searches.
+	using bfs_path_length_t = unsigned int;
 
 	enum directivity_t
 	{
@@ -7,7 +7,13 @@
 
 #include <catch2/catch.hpp>
 #include <quiver.hpp>
+#include "random_graph.hpp"
 using namespace quiver;
+#include <algorithm>
+#include <iterator>
+#include <vector>
+#include <cstdint>
+#include <type_traits>
 
 TEST_CASE("adjacency_list", "[quiver]")
 {
@@ -124,4 +130,222 @@ TEST_CASE("adjacency_list", "[quiver]")
 			CHECK(graph.E(2, 6) != nullptr);
 		}
 	}
+	SECTION("32-bit indices")
+	{
+		using graph_t = adjacency_list<directed, void, void, vector, vector, std::uint32_t>;
+		static_assert(std::is_same_v<graph_t::vertex_index_type, std::uint32_t>);
+		static_assert(sizeof(graph_t::out_edge_t) == sizeof(std::uint32_t));
+
+		graph_t graph(4);
+		CHECK(graph.E.emplace(0, 1));
+		CHECK(graph.E.emplace(1, 3));
+		CHECK(graph.E.emplace(3, 2));
+		CHECK(!graph.E.emplace(3, 2));
+		CHECK(graph.E.size() == 3);
+
+		CHECK(graph.V.erase(1));
+		REQUIRE(graph.V.size() == 3);
+		CHECK(graph.E.size() == 1);
+		CHECK(graph.E(2, 1) != nullptr);
+
+		const auto undirected = graph.to_undirected();
+		static_assert(std::is_same_v<std::decay_t<decltype(undirected)>::vertex_index_type, std::uint32_t>);
+		CHECK(undirected.E.size() == 1);
+		CHECK(undirected.E(1, 2) != nullptr);
+	}
+	SECTION("in-edge index")
+	{
+		using graph_t = adjacency_list<directed, wt<int>, void, vector, vector, vertex_index_t, vector>;
+		static_assert(graph_t::has_in_edges);
+		static_assert(!adjacency_list<directed>::has_in_edges);
+
+		// compares the in-edge index with the out-edges
+		const auto consistent = [](graph_t const& graph) {
+			for(vertex_index_t v = 0; v < graph.V.size(); ++v) {
+				std::vector<vertex_index_t> expected, actual;
+				for(vertex_index_t u = 0; u < graph.V.size(); ++u)
+					if(graph.V[u].has_edge_to(v))
+						expected.push_back(u);
+				for(auto const& in_edge : graph.V[v].in_edges)
+					actual.push_back(in_edge.from);
+				std::sort(actual.begin(), actual.end());
+				if(actual != expected || graph.in_degree(v) != expected.size())
+					return false;
+			}
+			return true;
+		};
+
+		quiver_test::lcg random(7);
+		graph_t graph(30);
+		for(int i = 0; i < 200; ++i) {
+			const vertex_index_t from = random(30), to = random(30);
+			if(from != to)
+				graph.E.emplace(from, to, i);
+		}
+		CHECK(consistent(graph));
+		for(int i = 0; i < 100; ++i)
+			graph.E.erase(random(30), random(30));
+		CHECK(consistent(graph));
+		CHECK(graph.V.erase(4));
+		CHECK(graph.V.erase(17));
+		CHECK(consistent(graph));
+		const vertex_index_t clone = graph.cleave(3);
+		CHECK(graph.in_degree(clone) == graph.in_degree(3));
+		CHECK(consistent(graph));
+		graph.contract(0, 1);
+		CHECK(consistent(graph));
+		graph.V.emplace();
+		CHECK(graph.in_degree(graph.V.size() - 1) == 0);
+
+		const auto copy = graph;
+		CHECK(consistent(copy));
+		const auto undirected = graph.to_undirected();
+		CHECK(undirected.E.size() <= graph.E.size());
+		CHECK(graph.strip_edges().E.size() == 0);
+		CHECK(consistent(std::move(graph).strip_edges()));
+	}
+	SECTION("sorted adjacency")
+	{
+		using graph_t = adjacency_list<directed, wt<int>, void, sorted_vector>;
+		using reference_t = adjacency_list<directed, wt<int>, void>;
+		static_assert(is_sorted_container<graph_t::out_edge_list_t>);
+		static_assert(!is_sorted_container<reference_t::out_edge_list_t>);
+
+		quiver_test::lcg random(11);
+		graph_t graph(40);
+		reference_t reference(40);
+		for(int i = 0; i < 600; ++i) {
+			const vertex_index_t from = random(40), to = random(40);
+			if(from != to)
+				CHECK(graph.E.emplace(from, to, i) == reference.E.emplace(from, to, i));
+		}
+		for(int i = 0; i < 200; ++i) {
+			const vertex_index_t from = random(40), to = random(40);
+			CHECK(graph.E.erase(from, to) == reference.E.erase(from, to));
+		}
+		CHECK(graph.V.erase(5));
+		CHECK(reference.V.erase(5));
+		graph.contract(2, 9);
+		reference.contract(2, 9);
+
+		REQUIRE(graph.E.size() == reference.E.size());
+		for(vertex_index_t v = 0; v < graph.V.size(); ++v) {
+			auto const& out_edges = graph.V[v].out_edges;
+			CHECK(std::is_sorted(out_edges.begin(), out_edges.end(), [](auto const& x, auto const& y){ return x.to < y.to; }));
+			for(vertex_index_t to = 0; to < graph.V.size(); ++to) {
+				CHECK(graph.V[v].has_edge_to(to) == reference.V[v].has_edge_to(to));
+				if(reference.E(v, to) != nullptr && to != 2 && v != 2) {
+					REQUIRE(graph.E(v, to) != nullptr);
+					CHECK(graph.E(v, to)->weight == reference.E(v, to)->weight);
+				}
+			}
+		}
+
+		for(vertex_index_t u = 0; u < 10; ++u) {
+			std::vector<vertex_index_t> merged, expected;
+			common_out_neighbors(graph.V[u], graph.V[u + 1], std::back_inserter(merged));
+			common_out_neighbors(reference.V[u], reference.V[u + 1], std::back_inserter(expected));
+			std::sort(expected.begin(), expected.end());
+			CHECK(merged == expected);
+		}
+	}
+	SECTION("batched vertex erasure")
+	{
+		// erases every third vertex at once and compares with erasing them one by one
+		const auto check = [](auto graph) {
+			quiver_test::lcg random(13);
+			const std::size_t n = graph.V.size();
+			for(vertex_index_t to = 1; to < n; ++to)
+				graph.E.emplace(0, to, -int(to)); // a hub, which indexes its out-edges if it can
+			for(int i = 0; i < 2000; ++i) {
+				const vertex_index_t from = random(std::uint32_t(n)), to = random(std::uint32_t(n));
+				if(from != to)
+					graph.E.emplace(from, to, i);
+			}
+
+			std::vector<vertex_index_t> erased;
+			for(vertex_index_t v = 2; v < n; v += 3)
+				erased.push_back(v);
+			auto reference = graph;
+			for(auto iter = erased.rbegin(); iter != erased.rend(); ++iter)
+				CHECK(reference.V.erase(*iter));
+			const std::vector<vertex_index_t> remap = graph.V.erase(erased);
+
+			REQUIRE(remap.size() == n);
+			for(vertex_index_t v = 0; v < n; ++v)
+				CHECK(remap[v] == (v % 3 == 2 ? inf<vertex_index_t> : v - v / 3));
+			REQUIRE(graph.V.size() == reference.V.size());
+			CHECK(graph.E.size() == reference.E.size());
+			for(vertex_index_t from = 0; from < graph.V.size(); ++from) {
+				CHECK(graph.out_degree(from) == reference.out_degree(from));
+				CHECK(graph.in_degree(from) == reference.in_degree(from));
+				for(auto const& out_edge : reference.V[from].out_edges) {
+					REQUIRE(graph.E(from, out_edge.to) != nullptr);
+					CHECK(graph.E(from, out_edge.to)->weight == out_edge.weight);
+				}
+			}
+
+			const std::size_t before = graph.V.size();
+			const auto identity = graph.V.erase_if([](vertex_index_t) { return false; });
+			CHECK(graph.V.size() == before);
+			CHECK(identity[before - 1] == before - 1);
+			graph.V.erase_if([](vertex_index_t) { return true; });
+			CHECK(graph.V.size() == 0);
+			CHECK(graph.E.size() == 0);
+		};
+		check(adjacency_list<directed, wt<int>, void, vector, vector, vertex_index_t, vector>(150));
+		check(adjacency_list<undirected, wt<int>, void, sorted_vector>(150));
+		check(adjacency_list<directed, wt<int>, void, hash_indexed_vector>(150));
+	}
+	SECTION("batched edge operations")
+	{
+		// applies random batches with duplicates once at once and once edge by edge
+		const auto check = [](auto graph) {
+			using edge_t = typename decltype(graph)::edge_t;
+			quiver_test::lcg random(17);
+			const std::size_t n = graph.V.size();
+			auto reference = graph;
+			for(int round = 0; round < 6; ++round) {
+				std::vector<edge_t> batch;
+				std::size_t expected = 0;
+				for(int i = 0; i < 400; ++i) {
+					// a hub, which indexes its out-edges if it can
+					const vertex_index_t from = random(4) == 0 ? 0 : random(std::uint32_t(n)), to = random(std::uint32_t(n));
+					if(from == to)
+						continue;
+					batch.emplace_back(from, to, round * 1000 + i);
+					expected += reference.E.emplace(from, to, round * 1000 + i);
+				}
+				CHECK(graph.E.emplace_batch(batch) == expected);
+
+				batch.clear();
+				expected = 0;
+				for(int i = 0; i < 150; ++i) {
+					const vertex_index_t from = random(3) == 0 ? 0 : random(std::uint32_t(n)), to = random(std::uint32_t(n));
+					batch.emplace_back(from, to, 0);
+					expected += reference.E.erase(from, to);
+				}
+				CHECK(graph.E.erase_batch(batch) == expected);
+
+				REQUIRE(graph.E.size() == reference.E.size());
+				for(vertex_index_t from = 0; from < n; ++from) {
+					CHECK(graph.out_degree(from) == reference.out_degree(from));
+					CHECK(graph.in_degree(from) == reference.in_degree(from));
+					for(auto const& out_edge : reference.V[from].out_edges) {
+						REQUIRE(graph.E(from, out_edge.to) != nullptr);
+						CHECK(graph.E(from, out_edge.to)->weight == out_edge.weight);
+					}
+				}
+			}
+			if constexpr(is_sorted_container<typename decltype(graph)::out_edge_list_t>)
+				for(auto const& vertex : graph.V)
+					CHECK(std::is_sorted(vertex.out_edges.begin(), vertex.out_edges.end(), [](auto const& x, auto const& y){ return x.to < y.to; }));
+		};
+		check(adjacency_list<directed, wt<int>, void>(120));
+		check(adjacency_list<undirected, wt<int>, void>(120));
+		check(adjacency_list<directed, wt<int>, void, vector, vector, vertex_index_t, vector>(120));
+		check(adjacency_list<directed, wt<int>, void, sorted_vector>(120));
+		check(adjacency_list<undirected, wt<int>, void, hash_indexed_vector>(120));
+		check(adjacency_list<directed, wt<int>, void, list>(120));
+	}
 }
@@ -0,0 +1,142 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "random_graph.hpp"
+using namespace quiver;
+#include <memory_resource>
+#include <optional>
+#include <vector>
+#include <cstddef>
+
+namespace
+{
+	// counts the bytes which are allocated and not yet deallocated
+	class counting_resource : public std::pmr::memory_resource
+	{
+		void* do_allocate(std::size_t bytes, std::size_t alignment) override
+		{
+			outstanding += bytes;
+			++allocations;
+			return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+		}
+		void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+		{
+			outstanding -= bytes;
+			std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+		}
+		bool do_is_equal(std::pmr::memory_resource const& rhs) const noexcept override
+		{
+			return this == &rhs;
+		}
+
+	public:
+		std::size_t outstanding = 0;
+		std::size_t allocations = 0;
+	};
+}
+
+TEST_CASE("arena", "[quiver]")
+{
+	using graph_t = adjacency_list<directed, wt<int>, void, arena_vector, vector, vertex_index_t, arena_vector>;
+	using reference_t = adjacency_list<directed, wt<int>, void>;
+	static_assert(is_sane_container<graph_t::out_edge_list_t>);
+	static_assert(is_sane_container<arena_list<int>>);
+
+	quiver_test::lcg random(23);
+
+	SECTION("scope")
+	{
+		counting_resource resource;
+		{
+			std::optional<graph_t> graph;
+			reference_t reference(100);
+			{
+				arena_scope scope(resource);
+				graph.emplace(100);
+				for(int i = 0; i < 1000; ++i) {
+					const vertex_index_t from = random(100), to = random(100);
+					if(from != to)
+						CHECK(graph->E.emplace(from, to, i) == reference.E.emplace(from, to, i));
+				}
+			}
+			const std::size_t allocations = resource.allocations;
+			CHECK(allocations > 100);
+			// the containers keep their resource after the scope
+			for(vertex_index_t to = 1; to < 100; ++to)
+				graph->E.emplace(0, to, 0);
+			CHECK(resource.allocations > allocations);
+			CHECK(graph->V.erase(7));
+			CHECK(reference.V.erase(7));
+			for(vertex_index_t to = 1; to < 99; ++to)
+				reference.E.emplace(0, to, 0);
+			REQUIRE(graph->E.size() == reference.E.size());
+			for(vertex_index_t from = 0; from < 99; ++from)
+				for(auto const& out_edge : reference.V[from].out_edges)
+					CHECK(graph->E(from, out_edge.to)->weight == out_edge.weight);
+
+			// copies take the resource of the scope they are made in
+			const std::size_t before = resource.allocations;
+			const graph_t copy = *graph;
+			CHECK(resource.allocations == before);
+			CHECK(copy.E.size() == graph->E.size());
+		}
+		CHECK(resource.outstanding == 0);
+	}
+	SECTION("build_from_edges")
+	{
+		std::vector<graph_t::edge_t> edges;
+		for(int i = 0; i < 20000; ++i) {
+			const vertex_index_t from = random(500), to = random(500);
+			if(from != to)
+				edges.emplace_back(from, to, i);
+		}
+		thread_pool pool(4);
+		arena buffer(1 << 16);
+		{
+			arena_scope scope(buffer);
+			const auto graph = build_from_edges<graph_t>(500, edges, pool);
+			const auto reference = build_from_edges<reference_t>(500, edges, pool);
+			REQUIRE(graph.E.size() == reference.E.size());
+			for(vertex_index_t from = 0; from < 500; ++from) {
+				REQUIRE(graph.out_degree(from) == reference.out_degree(from));
+				CHECK(graph.V[from].out_edges.get_allocator().resource() == &buffer);
+			}
+		}
+		buffer.release();
+	}
+	SECTION("vertex_container")
+	{
+		using arena_graph_t = adjacency_list<directed, wt<int>, void, arena_vector, arena_vertex_vector, vertex_index_t, arena_vector>;
+		static_assert(is_sane_container<arena_graph_t::vertices_t>);
+
+		counting_resource resource;
+		{
+			std::optional<arena_graph_t> graph;
+			{
+				arena_scope scope(resource);
+				graph.emplace(100);
+				CHECK(resource.allocations == 1);
+				add_random_edges(*graph, 1000, random, [&]{ return int(random(1000)); });
+			}
+			const std::size_t outstanding = resource.outstanding;
+			// the vertices grow out of the scope, in the default resource, and return what they had to resource
+			for(int i = 0; i < 50; ++i)
+				graph->V.emplace();
+			CHECK(resource.outstanding < outstanding);
+			CHECK(graph->V.size() == 150);
+
+			const arena_graph_t copy = *graph;
+			CHECK(copy.E.size() == graph->E.size());
+			arena_graph_t moved = std::move(*graph);
+			graph.reset();
+			CHECK(moved.E.size() == copy.E.size());
+		}
+		CHECK(resource.outstanding == 0);
+	}
+}
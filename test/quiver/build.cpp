@@ -0,0 +1,91 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "random_graph.hpp"
+using namespace quiver;
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace
+{
+	// random edges with many duplicates, built once by E.emplace and once by build_from_edges
+	template<typename graph_t>
+	void check_build(std::size_t vertices, std::size_t edge_count, thread_pool& pool)
+	{
+		quiver_test::lcg random(4711);
+
+		std::vector<typename graph_t::edge_t> edges;
+		graph_t reference(vertices);
+		while(edges.size() < edge_count) {
+			const vertex_index_t from = random(std::uint32_t(vertices));
+			const vertex_index_t to = random(std::uint32_t(vertices));
+			if(from == to)
+				continue;
+			if constexpr(graph_t::is_weighted()) {
+				const int weight = int(random(1000));
+				edges.emplace_back(from, to, weight);
+				reference.E.emplace(from, to, weight);
+			} else {
+				edges.emplace_back(from, to);
+				reference.E.emplace(from, to);
+			}
+		}
+
+		const graph_t graph = build_from_edges<graph_t>(vertices, edges, pool);
+		REQUIRE(graph.V.size() == reference.V.size());
+		CHECK(graph.E.size() == reference.E.size());
+		for(vertex_index_t v = 0; v < vertices; ++v) {
+			CHECK(graph.out_degree(v) == reference.out_degree(v));
+			CHECK(graph.in_degree(v) == reference.in_degree(v));
+			CHECK(std::is_sorted(graph.V[v].out_edges.begin(), graph.V[v].out_edges.end(), [](auto const& lhs, auto const& rhs){ return lhs.to < rhs.to; }));
+			for(auto const& out_edge : reference.V[v].out_edges) {
+				auto const* built = graph.E(v, out_edge.to);
+				REQUIRE(built != nullptr);
+				if constexpr(graph_t::is_weighted())
+					CHECK(built->weight == out_edge.weight);
+			}
+		}
+	}
+}
+
+TEST_CASE("build_from_edges", "[quiver]")
+{
+	thread_pool pool(4);
+
+	SECTION("directed")
+	{
+		check_build<adjacency_list<directed, wt<int>, void>>(300, 20000, pool);
+	}
+	SECTION("undirected")
+	{
+		check_build<adjacency_list<undirected, wt<int>, void>>(300, 20000, pool);
+		check_build<adjacency_list<undirected, void, void>>(300, 20000, pool);
+	}
+	SECTION("containers")
+	{
+		check_build<adjacency_list<directed, wt<int>, void, sorted_vector>>(300, 20000, pool);
+		check_build<adjacency_list<directed, wt<int>, void, hash_indexed_vector>>(300, 20000, pool);
+		check_build<adjacency_list<directed, void, void, list, vector, std::uint32_t>>(300, 20000, pool);
+		check_build<adjacency_list<directed, wt<int>, void, vector, vector, vertex_index_t, vector>>(300, 20000, pool);
+	}
+	SECTION("sequential")
+	{
+		thread_pool inline_pool(1);
+		check_build<adjacency_list<undirected, wt<int>, void>>(1000, 5000, inline_pool);
+	}
+	SECTION("empty")
+	{
+		const std::vector<edge<void>> edges;
+		const auto graph = build_from_edges<adjacency_list<directed, void, void>>(10, edges, pool);
+		CHECK(graph.V.size() == 10);
+		CHECK(graph.E.size() == 0);
+	}
+}
@@ -0,0 +1,117 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "random_graph.hpp"
+using namespace quiver;
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+TEST_CASE("contraction_hierarchy", "[quiver]")
+{
+	using graph_t = adjacency_list<directed, wt<unsigned>, void>;
+	const std::size_t N = 400;
+	graph_t graph(N);
+	quiver_test::lcg random(12345);
+	// a ring road with random chords, such that most pairs are connected
+	for(vertex_index_t v = 0; v < N; ++v)
+		graph.E.emplace(v, (v + 1) % N, 1 + random(20));
+	add_random_edges(graph, 2 * N, random, [&]{ return 1 + random(100); });
+
+	const contraction_hierarchy hierarchy(graph);
+	REQUIRE(hierarchy.size() == N);
+	std::vector<bool> ranks(N, false);
+	for(vertex_index_t v = 0; v < N; ++v)
+		ranks[hierarchy.rank(v)] = true;
+	CHECK(std::count(ranks.begin(), ranks.end(), true) == N);
+
+	const auto check = [&](auto const& hierarchy){
+		decltype(hierarchy.shortest_path_to(0, 0)) path;
+		search_workspace<unsigned> expected(graph), forward, backward;
+		for(vertex_index_t start = 0; start < N; start += 13) {
+			dijkstra_shortest_path(graph, start, expected);
+			for(vertex_index_t target = 0; target < N; target += 7) {
+				path = hierarchy.shortest_path_to(start, target, forward, backward);
+				REQUIRE(path.reached() == expected.reached(target));
+				if(!path.reached())
+					continue;
+				CHECK(path.distance == expected.distance(target));
+				CHECK(path.vertices.front() == start);
+				CHECK(path.vertices.back() == target);
+				CHECK(quiver_test::path_length(graph, path.vertices) == path.distance);
+			}
+		}
+	};
+	check(hierarchy);
+
+	SECTION("serialization")
+	{
+		std::stringstream stream;
+		hierarchy.write(stream);
+		const auto copy = decltype(hierarchy)::read(stream);
+		REQUIRE(copy.size() == N);
+		CHECK(copy.upward().E.size() == hierarchy.upward().E.size());
+		CHECK(copy.downward().E.size() == hierarchy.downward().E.size());
+		check(copy);
+
+		std::string truncated = stream.str();
+		truncated.resize(truncated.size() / 2);
+		std::stringstream truncated_stream(truncated);
+		CHECK_THROWS_AS(decltype(hierarchy)::read(truncated_stream), malformed_input);
+		std::stringstream garbage("not a hierarchy at all");
+		CHECK_THROWS_AS(decltype(hierarchy)::read(garbage), malformed_input);
+
+		// the header is the tag, the sizes of scalar_t and index_t and the number of vertices
+		using index_t = decltype(hierarchy)::vertex_index_type;
+		const std::size_t ranks_offset = 8 + 4 + 4 + 8;
+		const auto read_corrupted = [&](auto corrupt) {
+			std::string corrupted = stream.str();
+			corrupt(corrupted);
+			std::stringstream corrupted_stream(corrupted);
+			return decltype(hierarchy)::read(corrupted_stream);
+		};
+		CHECK_THROWS_AS(read_corrupted([&](std::string& bytes) {
+			const std::uint64_t n = std::uint64_t(1) << 40;
+			std::memcpy(bytes.data() + ranks_offset - 8, &n, sizeof(n));
+		}), malformed_input);
+		CHECK_THROWS_AS(read_corrupted([&](std::string& bytes) {
+			std::fill(bytes.begin() + ranks_offset, bytes.begin() + ranks_offset + N * sizeof(index_t), '\0');
+		}), malformed_input);
+		// the first shortcut of the upward graph, redirected via its own end, which ranks above its start
+		CHECK_THROWS_AS(read_corrupted([&](std::string& bytes) {
+			std::size_t offset = ranks_offset + N * sizeof(index_t);
+			for(vertex_index_t from = 0; from < N; ++from) {
+				std::uint64_t edges;
+				std::memcpy(&edges, bytes.data() + offset, sizeof(edges));
+				offset += sizeof(edges);
+				for(; edges > 0; --edges) {
+					index_t to, via;
+					std::memcpy(&to, bytes.data() + offset, sizeof(to));
+					std::memcpy(&via, bytes.data() + offset + sizeof(index_t) + sizeof(unsigned), sizeof(via));
+					if(via != decltype(hierarchy)::no_via) {
+						std::memcpy(bytes.data() + offset + sizeof(index_t) + sizeof(unsigned), &to, sizeof(to));
+						return;
+					}
+					offset += 2 * sizeof(index_t) + sizeof(unsigned);
+				}
+			}
+			FAIL("the hierarchy has no upward shortcut");
+		}), malformed_input);
+	}
+	SECTION("weight_invokable")
+	{
+		const contraction_hierarchy hops(graph, [](vertex_index_t, graph_t::out_edge_t const&){ return 1u; });
+		const auto expected = bfs_shortest_path(graph, 5);
+		for(vertex_index_t target = 0; target < N; ++target)
+			CHECK(hops.shortest_path_to(5, target).distance == expected[target].first);
+	}
+}
@@ -0,0 +1,100 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include <vector>
+
+TEST_CASE("csr_graph", "[quiver]")
+{
+	SECTION("directed")
+	{
+		using graph_t = adjacency_list<directed, wt<int>, cap<int>>;
+		graph_t graph;
+		for(int i = 0; i < 5; ++i)
+			graph.V.emplace(i * 10);
+		graph.E.emplace(0, 3, 3);
+		graph.E.emplace(1, 2, 5);
+		graph.E.emplace(1, 4, 1);
+		graph.E.emplace(2, 0, 0);
+		graph.E.emplace(3, 2, 2);
+		graph.E.emplace(4, 0, 6);
+		graph.E.emplace(4, 3, 1);
+
+		const csr_graph csr(graph);
+		CHECK(is_directed_v<decltype(csr)> == true);
+		CHECK(is_weighted_v<decltype(csr)> == true);
+		REQUIRE(csr.V.size() == 5);
+		CHECK(csr.E.size() == 7);
+		CHECK(csr.V[3].capacity == 30);
+		CHECK(csr.V[1].out_degree() == 2);
+		CHECK(csr.in_degree(0) == 2);
+		CHECK(csr.V[4].has_edge_to(3));
+		CHECK(!csr.V[3].has_edge_to(4));
+
+		REQUIRE(csr.E(1, 4) != nullptr);
+		CHECK(csr.E(1, 4)->weight == 1);
+		CHECK(csr.E(4, 1) == nullptr);
+
+		SECTION("algorithms")
+		{
+			CHECK(dijkstra_shortest_path(csr, 1) == dijkstra_shortest_path(graph, 1));
+			CHECK(bfs_shortest_path(csr, 1) == bfs_shortest_path(graph, 1));
+			CHECK(tarjan_recursive(csr) == tarjan_recursive(graph));
+
+			std::vector<vertex_index_t> visited;
+			dfs(csr, 1, [&visited](vertex_index_t index){ visited.push_back(index); return false; });
+			CHECK(visited.size() == csr.V.size());
+		}
+		SECTION("copy")
+		{
+			csr_graph copy = csr;
+			REQUIRE(copy.V.size() == csr.V.size());
+			CHECK(copy.V[1].out_edges.begin() != csr.V[1].out_edges.begin());
+			CHECK(copy.E(1, 2)->weight == 5);
+		}
+		SECTION("roundtrip")
+		{
+			const graph_t back = csr.to_adjacency_list();
+			REQUIRE(back.V.size() == graph.V.size());
+			CHECK(back.E.size() == graph.E.size());
+			for(vertex_index_t v = 0; v < graph.V.size(); ++v) {
+				CHECK(back.V[v].capacity == graph.V[v].capacity);
+				for(auto const& out_edge : graph.V[v].out_edges) {
+					REQUIRE(back.E(v, out_edge.to) != nullptr);
+					CHECK(back.E(v, out_edge.to)->weight == out_edge.weight);
+				}
+			}
+		}
+	}
+	SECTION("undirected")
+	{
+		using graph_t = adjacency_list<undirected, wt<int>, void>;
+		graph_t graph(4);
+		graph.E.emplace(0, 1, 4);
+		graph.E.emplace(1, 2, 1);
+		graph.E.emplace(2, 3, 2);
+		graph.E.emplace(3, 0, 1);
+
+		csr_graph csr(graph);
+		CHECK(is_undirected_v<decltype(csr)> == true);
+		CHECK(csr.E.size() == 4);
+		CHECK(csr.degree(0) == 2);
+		REQUIRE(csr.E(1, 0) != nullptr);
+		CHECK(csr.E(1, 0)->weight == 4);
+
+		csr.V[0].out_edges[0].weight = 7;
+		CHECK(csr.E(0, 1)->weight == 7);
+
+		const auto mst = kruskal(csr);
+		CHECK(mst.V.size() == 4);
+		CHECK(mst.E.size() == 3);
+		CHECK(ccs(csr) == 1);
+		CHECK(csr.to_adjacency_list().E.size() == 4);
+	}
+}
@@ -8,6 +8,8 @@
 #include <catch2/catch.hpp>
 #include <quiver.hpp>
 using namespace quiver;
+#include <cstdint>
+#include <type_traits>
 
 TEST_CASE("disjoint_set", "[quiver][fundamentals]")
 {
@@ -69,3 +71,17 @@ TEST_CASE("disjoint_set", "[quiver][fundamentals]")
 	CHECK(set.find(1) == set.find(7));
 	CHECK(set.find(1) == set.find(9));
 }
+
+TEST_CASE("disjoint_set with 32-bit indices", "[quiver][fundamentals]")
+{
+	disjoint_set<path_compression, std::uint32_t> set(5);
+	static_assert(std::is_same_v<decltype(set.find(0)), std::uint32_t>);
+
+	CHECK(set.unite(0, 4));
+	CHECK(set.unite(4, 2));
+	CHECK(!set.unite(2, 0));
+	CHECK(set.sets() == 3);
+	CHECK(set.cardinality(2) == 3);
+	CHECK(set.same_set(0, 2));
+	CHECK(!set.same_set(1, 3));
+}
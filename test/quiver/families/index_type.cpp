@@ -0,0 +1,47 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include <type_traits>
+#include <cstdint>
+
+TEST_CASE("families with a 32-bit index type", "[quiver][families]")
+{
+	using graph_t = adjacency_list<undirected, void, void, vector, vector, std::uint32_t>;
+	constexpr auto same_type = [](auto const& graph){ return std::is_same_v<std::remove_cvref_t<decltype(graph)>, graph_t>; };
+
+	const auto K = complete<void, void, vector, vector, std::uint32_t>(5);
+	CHECK(same_type(K));
+	CHECK(K.E.size() == 10);
+
+	const auto K_m_n = complete_bipartite<void, void, vector, vector, std::uint32_t>(3, 4);
+	CHECK(same_type(K_m_n));
+	CHECK(K_m_n.E.size() == 12);
+
+	const auto S = star<void, void, vector, vector, std::uint32_t>(4);
+	CHECK(same_type(S));
+	CHECK(S.V.size() == 5);
+	CHECK(S.E.size() == 4);
+
+	const auto claw = quiver::claw<void, void, vector, vector, std::uint32_t>();
+	CHECK(same_type(claw));
+	CHECK(claw.E.size() == 3);
+
+	const auto C = cycle<void, void, vector, vector, std::uint32_t>(6);
+	CHECK(same_type(C));
+	CHECK(C.E.size() == 6);
+
+	const auto P = linear<void, void, vector, vector, std::uint32_t>(6);
+	CHECK(same_type(P));
+	CHECK(P.E.size() == 5);
+
+	const auto W = wheel<void, void, vector, vector, std::uint32_t>(6);
+	CHECK(same_type(W));
+	CHECK(W.E.size() == 10);
+}
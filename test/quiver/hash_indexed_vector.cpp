@@ -0,0 +1,150 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "random_graph.hpp"
+using namespace quiver;
+#include <algorithm>
+#include <vector>
+#include <set>
+
+TEST_CASE("hash_indexed_vector", "[quiver]")
+{
+	quiver_test::lcg random(31337);
+
+	SECTION("container")
+	{
+		using container_t = hash_indexed_vector<out_edge<void>, 8>;
+		static_assert(is_sane_container<container_t>);
+		static_assert(container_lookup_v<container_t> == lookup_t::hash);
+
+		container_t container;
+		std::set<vertex_index_t> expected;
+		for(int i = 0; i < 5000; ++i) {
+			const vertex_index_t key = random(300);
+			if(random(3) != 0) {
+				if(expected.insert(key).second)
+					container.emplace_back(key);
+			} else {
+				const auto iter = container.find(key);
+				CHECK((iter != container.end()) == (expected.count(key) == 1));
+				if(iter != container.end()) {
+					CHECK(iter->to == key);
+					container.erase(iter);
+					expected.erase(key);
+				}
+			}
+			REQUIRE(container.size() == expected.size());
+		}
+		for(vertex_index_t key = 0; key < 300; ++key)
+			CHECK((container.find(key) != container.end()) == (expected.count(key) == 1));
+
+		container.unindex();
+		for(auto& element : container)
+			element.to += 1000;
+		container.reindex();
+		for(vertex_index_t key : expected)
+			CHECK(container.find(key + 1000) != container.end());
+		CHECK(container.find(0) == container.end());
+	}
+	SECTION("adjacency_list")
+	{
+		using graph_t = adjacency_list<directed, wt<int>, void, hash_indexed_vector, vector, vertex_index_t, vector>;
+		using reference_t = adjacency_list<directed, wt<int>, void>;
+
+		// a hub with an edge to and from almost every vertex
+		const std::size_t N = 500;
+		graph_t graph(N);
+		reference_t reference(N);
+		for(vertex_index_t v = 1; v < N; ++v)
+			if(random(10) != 0) {
+				graph.E.emplace(0, v, int(v));
+				reference.E.emplace(0, v, int(v));
+				graph.E.emplace(v, 0, -int(v));
+				reference.E.emplace(v, 0, -int(v));
+			}
+		for(int i = 0; i < 3000; ++i) {
+			const vertex_index_t from = random(N), to = random(N);
+			if(from != to)
+				CHECK(graph.E.emplace(from, to, i) == reference.E.emplace(from, to, i));
+		}
+		for(int i = 0; i < 1500; ++i) {
+			const vertex_index_t from = random(10), to = random(N);
+			CHECK(graph.E.erase(from, to) == reference.E.erase(from, to));
+		}
+		CHECK(graph.V.erase(3));
+		CHECK(reference.V.erase(3));
+		CHECK(graph.V.erase(0));
+		CHECK(reference.V.erase(0));
+		graph.contract(5, 1);
+		reference.contract(5, 1);
+
+		const auto same = [&]() {
+			if(graph.E.size() != reference.E.size())
+				return false;
+			for(vertex_index_t from = 0; from < graph.V.size(); ++from) {
+				if(graph.out_degree(from) != reference.out_degree(from) || graph.in_degree(from) != reference.in_degree(from))
+					return false;
+				for(auto const& out_edge : reference.V[from].out_edges)
+					if(graph.E(from, out_edge.to) == nullptr)
+						return false;
+			}
+			return true;
+		};
+		CHECK(same());
+
+		graph.V.emplace();
+		reference.V.emplace();
+		for(vertex_index_t v = 0; v + 1 < graph.V.size(); ++v) {
+			graph.E.emplace(graph.V.size() - 1, v, 0);
+			reference.E.emplace(graph.V.size() - 1, v, 0);
+		}
+		CHECK(same());
+		CHECK(graph.E(graph.V.size() - 1, 7)->weight == 0);
+	}
+	SECTION("dfs and csr_graph")
+	{
+		using graph_t = adjacency_list<directed, wt<int>, void, hash_indexed_vector>;
+		using reference_t = adjacency_list<directed, wt<int>, void>;
+
+		// only emplaced edges, so that both graphs hold their out-edges in the same order
+		const std::size_t N = 300;
+		graph_t graph(N);
+		reference_t reference(N);
+		for(vertex_index_t v = 1; v < N; v += 2) {
+			graph.E.emplace(0, v, int(v));
+			reference.E.emplace(0, v, int(v));
+		}
+		for(int i = 0; i < 600; ++i) {
+			const vertex_index_t from = random(N), to = random(N);
+			if(from != to)
+				CHECK(graph.E.emplace(from, to, i) == reference.E.emplace(from, to, i));
+		}
+
+		search_workspace<> workspace;
+		for(vertex_index_t start : { 0, 2 }) {
+			std::vector<vertex_index_t> expected_order, order, workspace_order;
+			dfs(reference, start, [&expected_order](vertex_index_t index){ expected_order.push_back(index); return false; });
+			dfs(graph, start, [&order](vertex_index_t index){ order.push_back(index); return false; });
+			dfs(graph, start, [&workspace_order](vertex_index_t index){ workspace_order.push_back(index); return false; }, workspace);
+			CHECK(order == expected_order);
+			CHECK(workspace_order == expected_order);
+		}
+
+		const graph_t back = csr_graph(reference).to_adjacency_list<hash_indexed_vector>();
+		REQUIRE(back.V.size() == N);
+		CHECK(back.E.size() == reference.E.size());
+		for(vertex_index_t from = 0; from < N; ++from)
+			for(auto const& out_edge : reference.V[from].out_edges) {
+				REQUIRE(back.E(from, out_edge.to) != nullptr);
+				CHECK(back.E(from, out_edge.to)->weight == out_edge.weight);
+			}
+		for(vertex_index_t to = 1; to < N; ++to)
+			CHECK((back.E(0, to) == nullptr) == (reference.E(0, to) == nullptr));
+	}
+}
@@ -8,6 +8,8 @@
 #include <catch2/catch.hpp>
 #include <quiver.hpp>
 using namespace quiver;
+#include <vector>
+#include <cstddef>
 
 TEST_CASE("binary_heap", "[quiver][heaps]")
 {
@@ -101,6 +103,32 @@ TEST_CASE("binary_heap", "[quiver][heaps]")
 		}
 	}
 
+	SECTION("position tracker")
+	{
+		// values are indices into positions
+		std::vector<std::size_t> positions(6, ~std::size_t{});
+		auto tracker = [&positions](int value, std::size_t index){ positions[value] = index; };
+		binary_heap<int, std::less<>, std::vector<int>, decltype(tracker)> tracked(std::less<>{}, tracker);
+		for(int value : { 4, 2, 5, 0, 3 })
+			tracked.push(value);
+		const auto check_positions = [&]{
+			for(std::size_t i = 0; i < tracked.size(); ++i)
+				CHECK(positions[tracked.get(i)] == i);
+		};
+		check_positions();
+		tracked.pop();
+		check_positions();
+		tracked.decrease(positions[5], 1);
+		check_positions();
+		CHECK(tracked.extract_top() == 1);
+		check_positions();
+		tracked.erase(positions[4]);
+		check_positions();
+		CHECK(tracked.extract_top() == 2);
+		CHECK(tracked.extract_top() == 3);
+		CHECK(tracked.empty());
+	}
+
 	SECTION("update")
 	{
 		REQUIRE(heap2.get(1) == 2);
@@ -0,0 +1,82 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+TEST_CASE("bucket_queue", "[quiver][heaps]")
+{
+	static_assert(priority_heap<bucket_queue<unsigned>>);
+	static_assert(!addressable_heap<bucket_queue<unsigned>>);
+
+	SECTION("sort")
+	{
+		std::vector<std::uint16_t> values;
+		for(std::uint32_t i = 0; i < 1000; ++i)
+			values.push_back(static_cast<std::uint16_t>(i * 2654435761u >> 20));
+		bucket_queue<std::uint16_t> heap;
+		for(std::uint16_t value : values)
+			heap.push(value);
+		CHECK(heap.size() == values.size());
+		std::sort(values.begin(), values.end());
+		for(std::uint16_t value : values)
+			CHECK(heap.extract_top() == value);
+		CHECK(heap.empty());
+	}
+	SECTION("monotone")
+	{
+		// pushes not below the last minimum and at most the heaviest edge above it, as in Dijkstra's algorithm
+		bucket_queue<unsigned> heap;
+		heap.reserve(4);
+		heap.push(0u);
+		heap.push(3u);
+		CHECK(heap.extract_top() == 0);
+		heap.push(2u);
+		heap.push(2u);
+		CHECK(heap.extract_top() == 2);
+		heap.push(100u);
+		heap.push(6u);
+		CHECK(heap.top() == 2);
+		heap.pop();
+		CHECK(heap.extract_top() == 3);
+		heap.push(3u);
+		CHECK(heap.extract_top() == 3);
+		CHECK(heap.extract_top() == 6);
+		CHECK(heap.extract_top() == 100);
+		CHECK(heap.empty());
+		heap.clear();
+		heap.push(1u);
+		CHECK(heap.top() == 1);
+	}
+	SECTION("policies")
+	{
+		struct small_entry { std::size_t index; std::uint16_t distance; };
+		struct wide_entry { std::size_t index; std::uint32_t distance; };
+		struct real_entry { std::size_t index; double distance; };
+		static_assert(std::is_same_v<monotone_heap_policy::templ<small_entry>, bucket_queue_policy::templ<small_entry>>);
+		static_assert(std::is_same_v<monotone_heap_policy::templ<wide_entry>, radix_heap_policy::templ<wide_entry>>);
+		static_assert(std::is_same_v<monotone_heap_policy::templ<real_entry>, binary_heap_policy::templ<real_entry>>);
+		static_assert(keys_on_distance_v<bucket_queue_policy> && keys_on_distance_v<radix_heap_policy>);
+		static_assert(keys_on_distance_v<monotone_heap_policy, small_entry> && keys_on_distance_v<monotone_heap_policy, wide_entry>);
+		static_assert(!keys_on_distance_v<monotone_heap_policy, real_entry> && !keys_on_distance_v<monotone_heap_policy>);
+		static_assert(!keys_on_distance_v<binary_heap_policy> && !keys_on_distance_v<pairing_heap_policy>);
+
+		bucket_queue_policy::templ<small_entry> heap;
+		heap.push(small_entry{ 0, 5 });
+		heap.push(small_entry{ 1, 2 });
+		heap.push(small_entry{ 2, 9 });
+		CHECK(heap.extract_top().index == 1);
+		CHECK(heap.extract_top().index == 0);
+		CHECK(heap.extract_top().index == 2);
+	}
+}
@@ -0,0 +1,69 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+TEST_CASE("d_ary_heap", "[quiver][heaps]")
+{
+	static_assert(addressable_heap<quaternary_heap<int>>);
+
+	std::vector<int> values;
+	for(int i = 0; i < 100; ++i)
+		values.push_back(i * 37 % 101);
+
+	SECTION("4-ary")
+	{
+		quaternary_heap<int> heap;
+		for(int value : values)
+			heap.push(value);
+		CHECK(heap.size() == values.size());
+		std::sort(values.begin(), values.end());
+		for(int value : values)
+			CHECK(heap.extract_top() == value);
+		CHECK(heap.empty());
+	}
+	SECTION("8-ary merge")
+	{
+		octonary_heap<int> heap, heap2;
+		for(std::size_t i = 0; i < values.size(); ++i)
+			(i % 2 ? heap : heap2).push(values[i]);
+		heap.merge(std::move(heap2));
+		CHECK(heap.size() == values.size());
+		std::sort(values.begin(), values.end());
+		for(int value : values)
+			CHECK(heap.extract_top() == value);
+		CHECK(heap.empty());
+	}
+	SECTION("position tracker")
+	{
+		std::vector<std::size_t> positions(101, d_ary_heap<int>::null_handle);
+		auto tracker = [&positions](int value, std::size_t index){ positions[value] = index; };
+		d_ary_heap<int, 3, std::less<>, std::vector<int>, decltype(tracker)> tracked(std::less<>{}, tracker);
+		for(int value : values)
+			tracked.push(value);
+		const auto check_positions = [&]{
+			for(std::size_t i = 0; i < tracked.size(); ++i)
+				CHECK(positions[tracked.get(i)] == i);
+		};
+		check_positions();
+		tracked.pop();
+		check_positions();
+		tracked.decrease(positions[100], 0);
+		CHECK(tracked.top() == 0);
+		tracked.pop();
+		tracked.erase(positions[50]);
+		check_positions();
+		tracked.increase(positions[1], 64); // 64 is the only value in [0, 100] missing
+		check_positions();
+		CHECK(tracked.extract_top() == 2);
+	}
+}
@@ -0,0 +1,66 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <cstddef>
+
+TEST_CASE("fibonacci_heap", "[quiver][heaps]")
+{
+	static_assert(addressable_heap<fibonacci_heap<int>>);
+
+	std::vector<int> values;
+	for(int i = 0; i < 100; ++i)
+		values.push_back(i * 37 % 101);
+
+	SECTION("sort")
+	{
+		fibonacci_heap<int> heap;
+		for(int value : values)
+			heap.push(value);
+		CHECK(heap.size() == values.size());
+		std::sort(values.begin(), values.end());
+		for(int value : values) {
+			REQUIRE(heap.top() == value);
+			heap.pop();
+		}
+		CHECK(heap.empty());
+	}
+	SECTION("decrease")
+	{
+		// values are indices into handles
+		using heap_t = fibonacci_heap<int>;
+		std::vector<heap_t::handle_type> handles(101, heap_t::null_handle);
+		auto tracker = [&handles](int value, heap_t::handle_type handle){ handles[value] = handle; };
+		fibonacci_heap<int, std::less<>, decltype(tracker)> heap(std::less<>{}, tracker);
+		std::multiset<int> reference;
+		for(int value : values) {
+			CHECK(heap.push(value) == handles[value]);
+			reference.insert(value);
+		}
+		// interleave pops, which restructure the heap, with decreases
+		for(int i = 0; i < 20; ++i) {
+			REQUIRE(heap.extract_top() == *reference.begin());
+			reference.erase(reference.begin());
+			const int value = *std::prev(reference.end(), 1 + i % 5);
+			const int replacement = *reference.begin() - i % 3;
+			heap.decrease(handles[value], replacement);
+			reference.erase(reference.find(value));
+			reference.insert(replacement);
+			CHECK(heap.top() == *reference.begin());
+		}
+		REQUIRE(heap.size() == reference.size());
+		for(int value : reference)
+			CHECK(heap.extract_top() == value);
+		CHECK(heap.empty());
+	}
+}
@@ -0,0 +1,68 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+TEST_CASE("radix_heap", "[quiver][heaps]")
+{
+	static_assert(priority_heap<radix_heap<unsigned>>);
+	static_assert(!addressable_heap<radix_heap<unsigned>>);
+
+	SECTION("sort")
+	{
+		std::vector<std::uint64_t> values;
+		for(std::uint64_t i = 0; i < 100; ++i)
+			values.push_back(i * 0x9E3779B97F4A7C15 >> (i % 64));
+		radix_heap<std::uint64_t> heap;
+		for(std::uint64_t value : values)
+			heap.push(value);
+		CHECK(heap.size() == values.size());
+		std::sort(values.begin(), values.end());
+		for(std::uint64_t value : values)
+			CHECK(heap.extract_top() == value);
+		CHECK(heap.empty());
+	}
+	SECTION("monotone")
+	{
+		// pushes not below the last minimum, as in Dijkstra's algorithm
+		radix_heap<std::uint8_t> heap;
+		heap.push(std::uint8_t{ 10 });
+		heap.push(std::uint8_t{ 3 });
+		CHECK(heap.extract_top() == 3);
+		heap.push(std::uint8_t{ 3 });
+		heap.push(std::uint8_t{ 255 });
+		heap.push(std::uint8_t{ 7 });
+		CHECK(heap.extract_top() == 3);
+		CHECK(heap.top() == 7);
+		heap.push(std::uint8_t{ 8 });
+		CHECK(heap.extract_top() == 7);
+		CHECK(heap.extract_top() == 8);
+		CHECK(heap.extract_top() == 10);
+		CHECK(heap.extract_top() == 255);
+		CHECK(heap.empty());
+		heap.clear();
+		heap.push(std::uint8_t{ 0 });
+		CHECK(heap.top() == 0);
+	}
+	SECTION("projection")
+	{
+		struct entry { std::size_t index; unsigned distance; };
+		radix_heap_policy::templ<entry> heap;
+		heap.push(entry{ 0, 5 });
+		heap.push(entry{ 1, 2 });
+		heap.push(entry{ 2, 9 });
+		CHECK(heap.extract_top().index == 1);
+		CHECK(heap.extract_top().index == 0);
+		CHECK(heap.extract_top().index == 2);
+	}
+}
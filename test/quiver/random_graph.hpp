@@ -0,0 +1,82 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#ifndef QUIVER_TEST_RANDOM_GRAPH_HPP_INCLUDED
+#define QUIVER_TEST_RANDOM_GRAPH_HPP_INCLUDED
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include <type_traits>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace quiver_test
+{
+	// A linear congruential generator, so that the random graphs of the tests are the same on every platform,
+	// unlike those of the distributions of <random>.
+	class lcg
+	{
+		std::uint32_t m_state;
+
+	public:
+		explicit lcg(std::uint32_t seed) noexcept
+		: m_state(seed)
+		{
+		}
+
+		// a number in [0, bound)
+		std::uint32_t operator()(std::uint32_t bound) noexcept
+		{
+			m_state = m_state * 1664525u + 1013904223u;
+			return (m_state >> 8) % bound;
+		}
+	};
+
+	// Draws count pairs of vertices and emplaces an edge between those which differ. The properties of every
+	// edge are those returned by properties, which is invoked after its vertices have been drawn.
+	template<typename graph_t, typename properties_invokable_t>
+	void add_random_edges(graph_t& graph, std::size_t count, lcg& random, properties_invokable_t properties)
+	{
+		const auto n = std::uint32_t(graph.V.size());
+		for(std::size_t i = 0; i < count; ++i) {
+			const quiver::vertex_index_t from = random(n), to = random(n);
+			if(from != to)
+				graph.E.emplace(from, to, properties());
+		}
+	}
+	template<typename graph_t>
+	void add_random_edges(graph_t& graph, std::size_t count, lcg& random)
+	{
+		const auto n = std::uint32_t(graph.V.size());
+		for(std::size_t i = 0; i < count; ++i) {
+			const quiver::vertex_index_t from = random(n), to = random(n);
+			if(from != to)
+				graph.E.emplace(from, to);
+		}
+	}
+
+	// the length of path with the lightest edge between each pair of consecutive vertices
+	template<typename graph_t>
+	auto path_length(graph_t const& graph, std::vector<quiver::vertex_index_t> const& vertices)
+	{
+		using weight_t = std::remove_cvref_t<quiver::weight_type<graph_t>>;
+		weight_t result = weight_t(0);
+		for(std::size_t i = 0; i + 1 < vertices.size(); ++i) {
+			weight_t lightest = quiver::inf<weight_t>;
+			for(auto const& edge : graph.V[vertices[i]].out_edges)
+				if(edge.to == vertices[i + 1])
+					lightest = std::min(lightest, edge.weight);
+			REQUIRE(lightest != quiver::inf<weight_t>);
+			result += lightest;
+		}
+		return result;
+	}
+}
+
+#endif // !QUIVER_TEST_RANDOM_GRAPH_HPP_INCLUDED
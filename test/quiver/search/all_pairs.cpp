@@ -0,0 +1,78 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "../random_graph.hpp"
+using namespace quiver;
+#include <vector>
+
+TEST_CASE("all_pairs", "[quiver][search]")
+{
+	quiver_test::lcg random(12345);
+
+	// not a multiple of floyd_warshall_block_size
+	using graph_t = adjacency_list<directed, wt<unsigned>, void>;
+	const std::size_t N = 150;
+	graph_t graph(N);
+	add_random_edges(graph, 4 * N, random, [&]{ return random(100); });
+
+	std::vector<unsigned> expected(N * N);
+	for(vertex_index_t source = 0; source < N; ++source) {
+		const auto row = dijkstra_shortest_path(graph, source);
+		for(vertex_index_t target = 0; target < N; ++target)
+			expected[source * N + target] = row[target].first;
+	}
+
+	for(std::size_t threads : { 1, 3 }) {
+		thread_pool pool(threads);
+		std::vector<unsigned> distances(N * N, 0);
+		all_pairs_shortest_paths(graph, distances, pool);
+		CHECK(distances == expected);
+		std::vector<unsigned> floyd_warshall_distances(N * N, 0);
+		floyd_warshall(graph, floyd_warshall_distances, pool);
+		CHECK(floyd_warshall_distances == expected);
+	}
+
+	SECTION("weight_invokable")
+	{
+		const auto halves = [](vertex_index_t, graph_t::out_edge_t const& edge){ return edge.weight / 2.0; };
+		std::vector<double> distances(N * N), floyd_warshall_distances(N * N);
+		thread_pool pool(2);
+		all_pairs_shortest_paths(graph, distances, pool, halves);
+		floyd_warshall(graph, floyd_warshall_distances, pool, halves);
+		for(std::size_t i = 0; i < N * N; ++i) {
+			CHECK(distances[i] == (expected[i] == inf<unsigned> ? inf<double> : expected[i] / 2.0));
+			CHECK(floyd_warshall_distances[i] == distances[i]);
+		}
+	}
+	SECTION("negative weights")
+	{
+		adjacency_list<directed, wt<int>, void> negative(4);
+		negative.E.emplace(0, 1, 4);
+		negative.E.emplace(0, 2, 1);
+		negative.E.emplace(2, 1, -3);
+		negative.E.emplace(1, 3, 2);
+		std::vector<int> distances(16);
+		floyd_warshall(negative, distances);
+		CHECK(distances[0 * 4 + 1] == -2);
+		CHECK(distances[0 * 4 + 3] == 0);
+		CHECK(distances[2 * 4 + 3] == -1);
+		CHECK(distances[3 * 4 + 0] == inf<int>);
+
+		negative.E.emplace(3, 2, 0);
+		CHECK_THROWS_AS(floyd_warshall(negative, distances), negative_cycle);
+
+		// a negative cycle among many vertices, which must not overflow the distances
+		quiver_test::lcg random(3);
+		adjacency_list<directed, wt<int>, void> cyclic(90);
+		add_random_edges(cyclic, 1500, random, [&]{ return int(random(2000000)) - 1000000; });
+		std::vector<int> cyclic_distances(90 * 90);
+		thread_pool pool(4);
+		CHECK_THROWS_AS(floyd_warshall(cyclic, cyclic_distances, pool), negative_cycle);
+	}
+}
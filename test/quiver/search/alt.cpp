@@ -0,0 +1,92 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "../random_graph.hpp"
+using namespace quiver;
+#include <algorithm>
+#include <vector>
+
+TEST_CASE("alt", "[quiver][search]")
+{
+	quiver_test::lcg random(12345);
+
+	SECTION("directed")
+	{
+		using graph_t = adjacency_list<directed, wt<unsigned>, void>;
+		const std::size_t N = 500;
+		graph_t graph(N);
+		add_random_edges(graph, 4 * N, random, [&]{ return 1 + random(50); });
+
+		thread_pool pool(3);
+		search_workspace<unsigned> expected(graph);
+		for(landmark_selection_t selection : { farthest_selection, avoid_selection }) {
+			const alt_landmarks landmarks(graph, 6, selection, pool, dijkstra_default_weight_invokable<graph_t>());
+			REQUIRE(landmarks.size() == 6);
+			std::vector<vertex_index_t> distinct = landmarks.landmarks();
+			std::sort(distinct.begin(), distinct.end());
+			CHECK(std::adjacent_find(distinct.begin(), distinct.end()) == distinct.end());
+
+			for(vertex_index_t start = 0; start < N; start += 31) {
+				dijkstra_shortest_path(graph, start, expected);
+				for(vertex_index_t target = 0; target < N; target += 17) {
+					const unsigned distance = expected.reached(target) ? expected.distance(target) : inf<unsigned>;
+					// admissible: never above the distance, and zero from a vertex to itself
+					CHECK(landmarks.lower_bound(start, target) <= distance);
+					CHECK(landmarks.lower_bound(target, target) == 0);
+					const auto path = alt_shortest_path_to(graph, start, target, landmarks);
+					CHECK(path.distance == distance);
+					if(path.reached()) {
+						CHECK(path.vertices.front() == start);
+						CHECK(path.vertices.back() == target);
+					}
+				}
+			}
+		}
+
+		// the landmarks may also be given
+		const std::vector<vertex_index_t> given = { 1, 2, 3 };
+		const alt_landmarks fixed(graph, given, pool, dijkstra_default_weight_invokable<graph_t>());
+		CHECK(fixed.landmarks() == std::vector<vertex_index_t>{ 1, 2, 3 });
+		dijkstra_shortest_path(graph, 2, expected);
+		for(vertex_index_t target = 0; target < N; ++target)
+			if(expected.reached(target))
+				CHECK(fixed.lower_bound(2, target) == expected.distance(target));
+	}
+	SECTION("undirected")
+	{
+		// a W x W grid, where the landmarks end up in the corners
+		using graph_t = adjacency_list<undirected, wt<unsigned>, void>;
+		const std::size_t W = 30;
+		graph_t graph(W * W);
+		for(std::size_t y = 0; y < W; ++y)
+			for(std::size_t x = 0; x < W; ++x) {
+				if(x + 1 < W)
+					graph.E.emplace(y * W + x, y * W + x + 1, 1 + random(4));
+				if(y + 1 < W)
+					graph.E.emplace(y * W + x, (y + 1) * W + x, 1 + random(4));
+			}
+		const vertex_index_t start = 0, goal = W * W - 1 - W / 2;
+		const auto expected = dijkstra_shortest_path(graph, start);
+		for(landmark_selection_t selection : { farthest_selection, avoid_selection }) {
+			const alt_landmarks landmarks(graph, 4, selection);
+			std::size_t dijkstra_visited = 0, alt_visited = 0;
+			dijkstra(graph, start, [&](vertex_index_t index, unsigned){
+				++dijkstra_visited;
+				return index == goal;
+			});
+			astar(graph, start, landmarks.heuristic(goal), [&](vertex_index_t index, unsigned distance){
+				++alt_visited;
+				CHECK(distance == expected[index].first);
+				return index == goal;
+			});
+			CHECK(alt_visited < dijkstra_visited);
+			CHECK(alt_shortest_path_to(graph, start, goal, landmarks).distance == expected[goal].first);
+		}
+	}
+}
@@ -0,0 +1,91 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "../random_graph.hpp"
+using namespace quiver;
+#include <vector>
+#include <cstddef>
+
+TEST_CASE("astar", "[quiver][search]")
+{
+	// a W x W grid whose edges weigh at least 1, such that the manhattan distance is a consistent heuristic
+	using graph_t = adjacency_list<undirected, wt<unsigned>, void>;
+	const std::size_t W = 40;
+	graph_t graph(W * W);
+	quiver_test::lcg random(12345);
+	for(std::size_t y = 0; y < W; ++y)
+		for(std::size_t x = 0; x < W; ++x) {
+			if(x + 1 < W)
+				graph.E.emplace(y * W + x, y * W + x + 1, 1 + random(4));
+			if(y + 1 < W)
+				graph.E.emplace(y * W + x, (y + 1) * W + x, 1 + random(4));
+		}
+
+	const vertex_index_t start = 0, goal = (W / 2) * W + W / 2;
+	const auto manhattan = [&](vertex_index_t index){
+		const std::size_t x = index % W, y = index / W, goal_x = goal % W, goal_y = goal / W;
+		return unsigned((x > goal_x ? x - goal_x : goal_x - x) + (y > goal_y ? y - goal_y : goal_y - y));
+	};
+	const auto expected = dijkstra_shortest_path(graph, start);
+
+	std::size_t dijkstra_visited = 0;
+	dijkstra(graph, start, [&](vertex_index_t index, unsigned){
+		++dijkstra_visited;
+		return index == goal;
+	});
+	std::size_t astar_visited = 0;
+	const bool found = astar(graph, start, manhattan, [&](vertex_index_t index, unsigned distance){
+		++astar_visited;
+		CHECK(distance == expected[index].first);
+		return index == goal;
+	});
+	CHECK(found);
+	CHECK(astar_visited < dijkstra_visited);
+
+	SECTION("astar_shortest_path_to")
+	{
+		const auto path = astar_shortest_path_to(graph, start, goal, manhattan);
+		REQUIRE(path.reached());
+		CHECK(path.distance == expected[goal].first);
+		CHECK(path.vertices.front() == start);
+		CHECK(path.vertices.back() == goal);
+		unsigned length = 0;
+		for(std::size_t i = 0; i + 1 < path.vertices.size(); ++i) {
+			REQUIRE(graph.V[path.vertices[i]].has_edge_to(path.vertices[i + 1]));
+			for(auto const& edge : graph.V[path.vertices[i]].out_edges)
+				if(edge.to == path.vertices[i + 1])
+					length += edge.weight;
+		}
+		CHECK(length == path.distance);
+
+		const auto zero = [](vertex_index_t){ return 0u; };
+		for(vertex_index_t target = 0; target < W * W; target += 17)
+			CHECK(astar_shortest_path_to<pairing_heap_policy>(graph, start, target, zero).distance == expected[target].first);
+	}
+	SECTION("monotone_heap_policy")
+	{
+		// selects a binary_heap for floating point distances, which orders by the estimate
+		adjacency_list<undirected, wt<double>, void> real_graph(W * W);
+		for(vertex_index_t from = 0; from < W * W; ++from)
+			for(auto const& edge : graph.V[from].out_edges)
+				if(from < edge.to)
+					real_graph.E.emplace(from, edge.to, double(edge.weight));
+		const auto real_manhattan = [&](vertex_index_t index){ return double(manhattan(index)); };
+		for(vertex_index_t target = 0; target < W * W; target += 17)
+			CHECK(astar_shortest_path_to<monotone_heap_policy>(real_graph, start, target, real_manhattan).distance == double(expected[target].first));
+	}
+	SECTION("unreachable")
+	{
+		graph_t disconnected(3);
+		disconnected.E.emplace(0, 1, 1u);
+		const auto path = astar_shortest_path_to(disconnected, 0, 2, [](vertex_index_t){ return 0u; });
+		CHECK(!path.reached());
+		CHECK(path.distance == inf<unsigned>);
+	}
+}
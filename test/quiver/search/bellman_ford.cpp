@@ -0,0 +1,97 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "../random_graph.hpp"
+using namespace quiver;
+#include <vector>
+
+TEST_CASE("bellman_ford", "[quiver][search]")
+{
+	quiver_test::lcg random(4711);
+
+	SECTION("non-negative weights agree with dijkstra")
+	{
+		adjacency_list<directed, wt<unsigned>, void> graph(200);
+		add_random_edges(graph, 1000, random, [&]{ return random(50); });
+		const auto expected = dijkstra_shortest_path(graph, 0);
+		const auto bellman_ford = bellman_ford_shortest_path(graph, 0);
+		const auto spfa = spfa_shortest_path(graph, 0);
+		for(vertex_index_t v = 0; v < graph.V.size(); ++v) {
+			CHECK(bellman_ford[v].first == expected[v].first);
+			CHECK(spfa[v].first == expected[v].first);
+		}
+	}
+
+	// a DAG with negative weights, so that no cycle is negative; distances are checked against floyd_warshall
+	using graph_t = adjacency_list<directed, wt<int>, void>;
+	const std::size_t N = 120;
+	graph_t graph(N);
+	for(std::size_t i = 0; i < 5 * N; ++i) {
+		vertex_index_t from = random(N), to = random(N);
+		if(from > to)
+			std::swap(from, to);
+		if(from != to)
+			graph.E.emplace(from, to, int(random(40)) - 15);
+	}
+	// edges back to lower indices of large weight close cycles which are positive
+	for(std::size_t i = 0; i < N; ++i) {
+		const vertex_index_t from = random(N), to = random(N);
+		if(from > to)
+			graph.E.emplace(from, to, 1000);
+	}
+
+	std::vector<int> expected(N * N);
+	floyd_warshall(graph, expected);
+	for(vertex_index_t v = 0; v < N; ++v)
+		REQUIRE(expected[v * N + v] == 0);
+
+	SECTION("single source")
+	{
+		for(vertex_index_t source : { 0, 7, 60 }) {
+			const auto bellman_ford = bellman_ford_shortest_path(graph, source);
+			const auto spfa = spfa_shortest_path(graph, source);
+			for(vertex_index_t v = 0; v < N; ++v) {
+				CHECK(bellman_ford[v].first == expected[source * N + v]);
+				CHECK(spfa[v].first == expected[source * N + v]);
+				if(v != source && bellman_ford[v].first != inf<int>) {
+					const auto predecessor = bellman_ford[v].second;
+					CHECK(bellman_ford[predecessor].first + graph.E(predecessor, v)->weight == bellman_ford[v].first);
+				}
+			}
+			CHECK(bellman_ford[source].second == source);
+		}
+	}
+	SECTION("johnson")
+	{
+		for(std::size_t threads : { 1, 3 }) {
+			thread_pool pool(threads);
+			std::vector<int> distances(N * N);
+			johnson_all_pairs_shortest_paths(graph, distances, pool);
+			CHECK(distances == expected);
+		}
+	}
+	SECTION("negative cycle")
+	{
+		graph_t cyclic(4);
+		cyclic.E.emplace(0, 1, 1);
+		cyclic.E.emplace(1, 2, -2);
+		cyclic.E.emplace(2, 1, 1);
+		cyclic.E.emplace(2, 3, 1);
+		CHECK_THROWS_AS(bellman_ford_shortest_path(cyclic, 0), negative_cycle);
+		CHECK_THROWS_AS(spfa_shortest_path(cyclic, 0), negative_cycle);
+		std::vector<int> distances(16);
+		CHECK_THROWS_AS(johnson_all_pairs_shortest_paths(cyclic, distances), negative_cycle);
+
+		// unreachable from start, the cycle does not matter
+		const auto bellman_ford = bellman_ford_shortest_path(cyclic, 3);
+		CHECK(bellman_ford[3].first == 0);
+		CHECK(bellman_ford[0].first == inf<int>);
+		CHECK(spfa_shortest_path(cyclic, 3)[1].first == inf<int>);
+	}
+}
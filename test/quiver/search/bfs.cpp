@@ -47,3 +47,25 @@ TEST_CASE("bfs", "[quiver][search]")
 		CHECK((shortest_path[4] == pair_t(2, 2) || shortest_path[4] == pair_t(2, 3)));
 	}
 }
+
+TEST_CASE("bfs_shortest_path_to", "[quiver][search]")
+{
+	using graph_t = adjacency_list<undirected, void, void>;
+	graph_t graph(7);
+	for(vertex_index_t v = 0; v + 1 < 6; ++v)
+		graph.E.emplace(v, v + 1);
+	graph.E.emplace(0, 5);
+
+	const auto path = bfs_shortest_path_to(graph, 0, 4);
+	CHECK(path.distance == 2);
+	CHECK(path.vertices == std::vector<vertex_index_t>{ 0, 5, 4 });
+	CHECK(!bfs_shortest_path_to(graph, 0, 6).reached());
+
+	search_workspace<> workspace;
+	const std::vector<vertex_index_t> targets = { 1, 2 };
+	const auto paths = bfs_shortest_path_to(graph, 0, targets, workspace);
+	REQUIRE(paths.size() == 2);
+	CHECK(paths[0].vertices == std::vector<vertex_index_t>{ 0, 1 });
+	CHECK(paths[1].vertices == std::vector<vertex_index_t>{ 0, 1, 2 });
+	CHECK(!workspace.reached(3));
+}
@@ -0,0 +1,84 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "../random_graph.hpp"
+using namespace quiver;
+#include <vector>
+
+TEST_CASE("bidirectional_dijkstra_shortest_path_to", "[quiver][search]")
+{
+	using graph_t = adjacency_list<directed, wt<unsigned>, void>;
+	const std::size_t N = 300;
+	graph_t graph(N);
+	quiver_test::lcg random(12345);
+	add_random_edges(graph, 4 * N, random, [&]{ return random(100); });
+	const reverse_index<graph_t> reverse(graph);
+
+
+	search_workspace<unsigned> forward(graph), backward(graph), expected_workspace(graph);
+	for(vertex_index_t start = 0; start < N; start += 7) {
+		const auto expected = dijkstra_shortest_path(graph, start, expected_workspace);
+		for(vertex_index_t target = 0; target < N; target += 11) {
+			const auto path = bidirectional_dijkstra_shortest_path_to(graph, start, target, reverse, forward, backward);
+			REQUIRE(path.reached() == expected.reached(target));
+			if(!path.reached()) {
+				CHECK(path.distance == inf<unsigned>);
+				continue;
+			}
+			CHECK(path.distance == expected.distance(target));
+			CHECK(path.vertices.front() == start);
+			CHECK(path.vertices.back() == target);
+			CHECK(quiver_test::path_length(graph, path.vertices) == path.distance);
+		}
+	}
+
+	SECTION("trivial")
+	{
+		const auto path = bidirectional_dijkstra_shortest_path_to(graph, 5, 5, reverse);
+		CHECK(path.distance == 0);
+		CHECK(path.vertices == std::vector<vertex_index_t>{ 5 });
+	}
+	SECTION("custom weights")
+	{
+		const auto hops = [](vertex_index_t, graph_t::out_edge_t const&){ return 1u; };
+		const auto expected = bfs_shortest_path(graph, 0);
+		for(vertex_index_t target = 0; target < N; ++target)
+			CHECK(bidirectional_dijkstra_shortest_path_to(graph, 0, target, reverse, hops).distance == expected[target].first);
+	}
+}
+
+TEST_CASE("bidirectional_bfs_shortest_path_to", "[quiver][search]")
+{
+	using graph_t = adjacency_list<directed, void, void>;
+	const std::size_t N = 1000;
+	graph_t graph(N);
+	quiver_test::lcg random(54321);
+	add_random_edges(graph, 2 * N, random);
+	const reverse_index<graph_t> reverse(graph);
+
+	search_workspace<> forward(graph), backward(graph);
+	for(vertex_index_t start = 0; start < N; start += 37) {
+		const auto expected = bfs_shortest_path(graph, start);
+		for(vertex_index_t target = 0; target < N; target += 13) {
+			const auto path = bidirectional_bfs_shortest_path_to(graph, start, target, reverse, forward, backward);
+			CHECK(path.distance == expected[target].first);
+			if(!path.reached())
+				continue;
+			REQUIRE(path.vertices.size() == path.distance + 1);
+			CHECK(path.vertices.front() == start);
+			CHECK(path.vertices.back() == target);
+			for(std::size_t i = 0; i + 1 < path.vertices.size(); ++i)
+				CHECK(graph.V[path.vertices[i]].has_edge_to(path.vertices[i + 1]));
+		}
+	}
+
+	const auto trivial = bidirectional_bfs_shortest_path_to(graph, 3, 3, reverse);
+	CHECK(trivial.distance == 0);
+	CHECK(trivial.vertices == std::vector<vertex_index_t>{ 3 });
+}
@@ -0,0 +1,73 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "../random_graph.hpp"
+using namespace quiver;
+#include <vector>
+
+TEST_CASE("delta_stepping", "[quiver][search]")
+{
+	using graph_t = adjacency_list<directed, wt<unsigned>, void>;
+	const std::size_t N = 2000;
+	graph_t graph(N);
+	quiver_test::lcg random(12345);
+	add_random_edges(graph, 6 * N, random, [&]{ return random(100); });
+
+	const auto expected = dijkstra_shortest_path(graph, 0);
+	const auto check = [&](auto const& result){
+		REQUIRE(result.size() == N);
+		for(vertex_index_t v = 0; v < N; ++v) {
+			CHECK(result[v].first == expected[v].first);
+			if(v == 0 || result[v].first == inf<unsigned>)
+				continue;
+			// the predecessor shall be the source of an edge on a shortest path
+			const vertex_index_t predecessor = result[v].second;
+			bool tight = false;
+			for(auto const& edge : graph.V[predecessor].out_edges)
+				tight = tight || (edge.to == v && result[predecessor].first + edge.weight == result[v].first);
+			CHECK(tight);
+		}
+	};
+
+	thread_pool single(1);
+	const auto reference = delta_stepping_shortest_path(graph, 0, 25u, single);
+	check(reference);
+	for(std::size_t threads : { 2, 4 }) {
+		thread_pool pool(threads);
+		for(unsigned delta : { 1u, 25u, 1000u }) {
+			const auto result = delta_stepping_shortest_path(graph, 0, delta, pool);
+			check(result);
+			if(delta == 25u)
+				CHECK(result == reference);
+		}
+	}
+
+	SECTION("weight_invokable and multiple starts")
+	{
+		thread_pool pool(3);
+		const auto hops = [](vertex_index_t, graph_t::out_edge_t const&){ return 1u; };
+		const std::vector<vertex_index_t> starts = { 3, 7, 3 };
+		const auto bfs_result = bfs_shortest_path(graph, starts);
+		const auto result = delta_stepping_shortest_path(graph, starts, 2u, pool, hops);
+		REQUIRE(result.size() == N);
+		for(vertex_index_t v = 0; v < N; ++v)
+			CHECK(result[v].first == bfs_result[v].first);
+	}
+	SECTION("long paths")
+	{
+		// the distances reach 10^7, i.e. as many buckets of width 1, of which only max weight + 2 are kept
+		graph_t path(10001);
+		for(vertex_index_t v = 0; v + 1 < path.V.size(); ++v)
+			path.E.emplace(v, v + 1, 1000u - unsigned(v % 2));
+		thread_pool pool(2);
+		const auto result = delta_stepping_shortest_path(path, 0, 1u, pool);
+		const auto path_expected = dijkstra_shortest_path(path, 0);
+		CHECK(result == path_expected);
+	}
+}
@@ -7,9 +7,45 @@
 
 #include <catch2/catch.hpp>
 #include <quiver.hpp>
+#include "../random_graph.hpp"
 using namespace quiver;
 #include <vector>
 #include <unordered_map>
+#include <cstdint>
+#include <type_traits>
+
+TEST_CASE("dijkstra strategies", "[quiver][search]")
+{
+	using graph_t = adjacency_list<directed, wt<unsigned>, void>;
+	const std::size_t N = 200;
+	graph_t graph(N);
+	quiver_test::lcg random(12345);
+	add_random_edges(graph, 8 * N, random, [&]{ return random(100); });
+
+	const auto always_insert_result = dijkstra_shortest_path<always_insert>(graph, 0);
+	const auto decrease_key_result = dijkstra_shortest_path<decrease_key>(graph, 0);
+	REQUIRE(always_insert_result.size() == decrease_key_result.size());
+	for(vertex_index_t v = 0; v < N; ++v)
+		CHECK(always_insert_result[v].first == decrease_key_result[v].first);
+
+	SECTION("heaps")
+	{
+		const auto check_distances = [&](auto const& result){
+			REQUIRE(result.size() == N);
+			for(vertex_index_t v = 0; v < N; ++v)
+				CHECK(result[v].first == always_insert_result[v].first);
+		};
+		check_distances(dijkstra_shortest_path<always_insert, d_ary_heap_policy<4>>(graph, 0));
+		check_distances(dijkstra_shortest_path<decrease_key, d_ary_heap_policy<8>>(graph, 0));
+		check_distances(dijkstra_shortest_path<always_insert, pairing_heap_policy>(graph, 0));
+		check_distances(dijkstra_shortest_path<decrease_key, pairing_heap_policy>(graph, 0));
+		check_distances(dijkstra_shortest_path<always_insert, fibonacci_heap_policy>(graph, 0));
+		check_distances(dijkstra_shortest_path<decrease_key, fibonacci_heap_policy>(graph, 0));
+		check_distances(dijkstra_shortest_path<always_insert, radix_heap_policy>(graph, 0));
+		check_distances(dijkstra_shortest_path<always_insert, bucket_queue_policy>(graph, 0));
+		check_distances(dijkstra_shortest_path<always_insert, binary_heap_policy>(graph, 0));
+	}
+}
 
 TEST_CASE("dijkstra", "[quiver][search]")
 {
@@ -56,5 +92,87 @@ TEST_CASE("dijkstra", "[quiver][search]")
 		CHECK(shortest_path[2] == pair_t(4, 3));
 		CHECK(shortest_path[3] == pair_t(2, 4));
 		CHECK(shortest_path[4] == pair_t(1, 1));
+
+		SECTION("decrease_key")
+		{
+			std::vector<vertex_index_t> visited_dk;
+			auto visitor_dk = [&](vertex_index_t index, distance_t distance){
+				visited_dk.push_back(index);
+				CHECK(distances[index] == distance);
+				return false;
+			};
+			CHECK(dijkstra<decrease_key>(graph, 1, visitor_dk) == false);
+			CHECK(visited_dk == visited);
+			CHECK(dijkstra_shortest_path<decrease_key>(graph, 1) == shortest_path);
+		}
+		SECTION("32-bit indices")
+		{
+			using narrow_graph_t = adjacency_list<directed, wt<distance_t>, void, vector, vector, std::uint32_t>;
+			narrow_graph_t narrow(graph.V.size());
+			for(vertex_index_t v = 0; v < graph.V.size(); ++v)
+				for(auto const& out_edge : graph.V[v].out_edges)
+					narrow.E.emplace(v, out_edge.to, out_edge.weight);
+
+			const auto narrow_shortest_path = dijkstra_shortest_path(narrow, 1);
+			static_assert(std::is_same_v<decltype(narrow_shortest_path)::value_type, std::pair<distance_t, std::uint32_t>>);
+			REQUIRE(narrow_shortest_path.size() == shortest_path.size());
+			for(vertex_index_t v = 0; v < graph.V.size(); ++v) {
+				CHECK(narrow_shortest_path[v].first == shortest_path[v].first);
+				CHECK(narrow_shortest_path[v].second == shortest_path[v].second);
+			}
+		}
+	}
+}
+
+TEST_CASE("dijkstra_shortest_path_to", "[quiver][search]")
+{
+	using graph_t = adjacency_list<directed, wt<int>, void>;
+	graph_t graph(6);
+	graph.E.emplace(0, 1, 7);
+	graph.E.emplace(0, 2, 2);
+	graph.E.emplace(2, 1, 3);
+	graph.E.emplace(1, 3, 1);
+	graph.E.emplace(2, 3, 9);
+	graph.E.emplace(3, 4, 4);
+	// 5 is unreachable
+
+	const auto path = dijkstra_shortest_path_to(graph, 0, 3);
+	CHECK(path.reached());
+	CHECK(path.distance == 6);
+	CHECK(path.vertices == std::vector<vertex_index_t>{ 0, 2, 1, 3 });
+
+	const auto unreachable = dijkstra_shortest_path_to(graph, 0, 5);
+	CHECK(!unreachable.reached());
+	CHECK(unreachable.distance == inf<int>);
+
+	search_workspace<int> workspace;
+	std::size_t visits = 0;
+	dijkstra(graph, 0, [&visits](vertex_index_t, int){ ++visits; return false; }, workspace);
+	REQUIRE(visits == 5);
+
+	SECTION("stops early")
+	{
+		const auto to_2 = dijkstra_shortest_path_to(graph, 0, 2, workspace);
+		CHECK(to_2.vertices == std::vector<vertex_index_t>{ 0, 2 });
+		CHECK(workspace.reached(2));
+		CHECK(!workspace.reached(1));
+		CHECK(!workspace.reached(4));
+	}
+	SECTION("multiple targets")
+	{
+		const std::vector<vertex_index_t> targets = { 4, 1, 5, 1 };
+		const auto paths = dijkstra_shortest_path_to(graph, 0, targets, workspace);
+		REQUIRE(paths.size() == 4);
+		CHECK(paths[0].distance == 10);
+		CHECK(paths[0].vertices == std::vector<vertex_index_t>{ 0, 2, 1, 3, 4 });
+		CHECK(paths[1].distance == 5);
+		CHECK(!paths[2].reached());
+		CHECK(paths[3].vertices == paths[1].vertices);
+	}
+	SECTION("multiple starts")
+	{
+		const auto from_1_or_2 = dijkstra_shortest_path_to(graph, std::vector<vertex_index_t>{ 1, 2 }, 4, [](vertex_index_t, graph_t::out_edge_t const&){ return 1; });
+		CHECK(from_1_or_2.distance == 2);
+		CHECK(from_1_or_2.vertices.size() == 3);
 	}
 }
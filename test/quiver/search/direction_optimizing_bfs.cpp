@@ -0,0 +1,59 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "../random_graph.hpp"
+using namespace quiver;
+#include <vector>
+
+TEST_CASE("direction_optimizing_bfs", "[quiver][search]")
+{
+	quiver_test::lcg random(12345);
+
+	using graph_t = adjacency_list<directed, void, void>;
+	const std::size_t N = 2000;
+	graph_t graph(N);
+	add_random_edges(graph, 8 * N, random);
+	const reverse_index<graph_t> reverse(graph);
+	REQUIRE(reverse.edges() == graph.E.size());
+
+	const auto expected = bfs_shortest_path(graph, 0);
+	const auto check = [&](auto const& result){
+		REQUIRE(result.size() == N);
+		for(vertex_index_t v = 0; v < N; ++v) {
+			CHECK(result[v].first == expected[v].first);
+			if(v != 0 && result[v].first != inf<bfs_path_length_t>) {
+				const vertex_index_t predecessor = result[v].second;
+				CHECK(graph.V[predecessor].has_edge_to(v));
+				CHECK(expected[predecessor].first + 1 == result[v].first);
+			}
+		}
+	};
+
+	SECTION("default heuristic")
+	{
+		check(direction_optimizing_bfs_shortest_path(graph, 0, reverse));
+		check(direction_optimizing_bfs_shortest_path(graph, 0));
+	}
+	SECTION("top-down only")
+	{
+		CHECK(direction_optimizing_bfs_shortest_path(graph, 0, reverse, { 0, 1e9 }) == expected);
+	}
+	SECTION("bottom-up only")
+	{
+		check(direction_optimizing_bfs_shortest_path(graph, 0, reverse, { 1e9, 1e9 }));
+	}
+	SECTION("multiple starts")
+	{
+		const std::vector<vertex_index_t> starts = { 3, 1999, 3 };
+		const auto result = direction_optimizing_bfs_shortest_path(graph, starts, reverse);
+		const auto reference = bfs_shortest_path(graph, starts);
+		for(vertex_index_t v = 0; v < N; ++v)
+			CHECK(result[v].first == reference[v].first);
+	}
+}
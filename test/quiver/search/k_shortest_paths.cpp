@@ -0,0 +1,92 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "../random_graph.hpp"
+using namespace quiver;
+#include <algorithm>
+#include <functional>
+#include <vector>
+#include <set>
+
+TEST_CASE("k_shortest_paths", "[quiver][search]")
+{
+	SECTION("example")
+	{
+		// the example of Yen's algorithm on Wikipedia, C = 0, D = 1, E = 2, F = 3, G = 4, H = 5
+		adjacency_list<directed, wt<int>, void> graph(6);
+		graph.E.emplace(0, 1, 3);
+		graph.E.emplace(0, 2, 2);
+		graph.E.emplace(1, 3, 4);
+		graph.E.emplace(2, 1, 1);
+		graph.E.emplace(2, 3, 2);
+		graph.E.emplace(2, 4, 3);
+		graph.E.emplace(3, 4, 2);
+		graph.E.emplace(3, 5, 1);
+		graph.E.emplace(4, 5, 2);
+
+		k_shortest_paths_t generator(graph, 0, 5);
+		CHECK(generator.next().vertices == std::vector<vertex_index_t>{ 0, 2, 3, 5 });
+		const auto second = generator.next();
+		CHECK(second.distance == 7);
+		CHECK(generator.size() == 2);
+
+		const auto paths = k_shortest_paths(graph, 0, 5, 10);
+		REQUIRE(paths.size() == 7);
+		CHECK(paths[0].distance == 5);
+		CHECK(paths[1].distance == 7);
+		CHECK(paths[2].distance == 8);
+		CHECK(paths[3].distance == 8);
+		CHECK(paths.back().distance == 11);
+
+		CHECK(k_shortest_paths(graph, 5, 0, 3).empty());
+		const auto trivial = k_shortest_paths(graph, 2, 2, 3);
+		REQUIRE(trivial.size() == 1);
+		CHECK(trivial[0].vertices == std::vector<vertex_index_t>{ 2 });
+	}
+	SECTION("random graphs")
+	{
+		quiver_test::lcg random(99);
+		for(int iteration = 0; iteration < 20; ++iteration) {
+			using graph_t = adjacency_list<directed, wt<unsigned>, void>;
+			const std::size_t N = 9;
+			graph_t graph(N);
+			add_random_edges(graph, 3 * N, random, [&]{ return random(10); });
+
+			// the lengths of all loopless paths from 0 to N - 1, by depth first search
+			std::vector<unsigned> expected;
+			std::vector<bool> on_path(N, false);
+			const std::function<void(vertex_index_t, unsigned)> enumerate = [&](vertex_index_t vertex, unsigned length) {
+				if(vertex == N - 1) {
+					expected.push_back(length);
+					return;
+				}
+				on_path[vertex] = true;
+				for(auto const& edge : graph.V[vertex].out_edges)
+					if(!on_path[edge.to])
+						enumerate(edge.to, length + edge.weight);
+				on_path[vertex] = false;
+			};
+			enumerate(0, 0);
+			std::sort(expected.begin(), expected.end());
+
+			const auto paths = k_shortest_paths(graph, 0, N - 1, 25);
+			REQUIRE(paths.size() == std::min<std::size_t>(25, expected.size()));
+			std::set<std::vector<vertex_index_t>> distinct;
+			for(std::size_t i = 0; i < paths.size(); ++i) {
+				CHECK(paths[i].distance == expected[i]);
+				CHECK(distinct.insert(paths[i].vertices).second);
+				unsigned length = 0;
+				for(std::size_t j = 0; j + 1 < paths[i].vertices.size(); ++j)
+					length += graph.E(paths[i].vertices[j], paths[i].vertices[j + 1])->weight;
+				CHECK(length == paths[i].distance);
+				CHECK(std::set<vertex_index_t>(paths[i].vertices.begin(), paths[i].vertices.end()).size() == paths[i].vertices.size());
+			}
+		}
+	}
+}
@@ -0,0 +1,70 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "../random_graph.hpp"
+using namespace quiver;
+#include <vector>
+#include <bit>
+
+TEST_CASE("multi_source_bfs", "[quiver][search]")
+{
+	quiver_test::lcg random(2024);
+
+	adjacency_list<directed, void, void> graph(500);
+	add_random_edges(graph, 1200, random);
+
+	// more than two batches, with a duplicate source
+	std::vector<vertex_index_t> sources;
+	for(std::size_t i = 0; i < 150; ++i)
+		sources.push_back(random(500));
+	sources.push_back(sources.front());
+
+	std::vector<std::vector<bfs_path_length_t>> expected;
+	for(vertex_index_t source : sources) {
+		const auto row = bfs_shortest_path(graph, source);
+		expected.emplace_back();
+		for(auto const& entry : row)
+			expected.back().push_back(entry.first);
+	}
+
+	for(std::size_t threads : { 1, 3 }) {
+		thread_pool pool(threads);
+		std::vector<bfs_path_length_t> distances(sources.size() * graph.V.size());
+		multi_source_bfs_distances(graph, sources, distances, pool);
+		for(std::size_t i = 0; i < sources.size(); ++i)
+			CHECK(std::vector<bfs_path_length_t>(distances.begin() + i * graph.V.size(), distances.begin() + (i + 1) * graph.V.size()) == expected[i]);
+	}
+
+	SECTION("visitor")
+	{
+		const std::vector<vertex_index_t> batch(sources.begin(), sources.begin() + 64);
+		// the sums of the distances from each source, as for closeness
+		std::vector<std::size_t> sums(64, 0), expected_sums(64, 0);
+		std::size_t visits = 0;
+		multi_source_bfs(graph, batch, [&](vertex_index_t vertex, bfs_path_length_t level, multi_source_bfs_mask_t reached) {
+			(void)vertex;
+			++visits;
+			for(; reached != 0; reached &= reached - 1)
+				sums[std::countr_zero(reached)] += level;
+			return false;
+		});
+		for(std::size_t i = 0; i < 64; ++i)
+			for(bfs_path_length_t distance : expected[i])
+				if(distance != inf<bfs_path_length_t>)
+					expected_sums[i] += distance;
+		CHECK(sums == expected_sums);
+
+		std::size_t early = 0;
+		CHECK(multi_source_bfs(graph, batch, [&](vertex_index_t, bfs_path_length_t level, multi_source_bfs_mask_t) {
+			++early;
+			return level == 2;
+		}));
+		CHECK(early < visits);
+	}
+}
@@ -0,0 +1,46 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "../random_graph.hpp"
+using namespace quiver;
+#include <vector>
+#include <cstdint>
+
+TEST_CASE("parallel_bfs", "[quiver][search]")
+{
+	quiver_test::lcg random(12345);
+
+	SECTION("directed")
+	{
+		using graph_t = adjacency_list<directed, void, void>;
+		const std::size_t N = 3000;
+		graph_t graph(N);
+		add_random_edges(graph, 4 * N, random);
+
+		const auto expected = bfs_shortest_path(graph, 0);
+		for(std::size_t threads : { 1, 2, 4 }) {
+			thread_pool pool(threads);
+			CHECK(parallel_bfs_shortest_path(graph, 0, pool) == expected);
+		}
+		const std::vector<vertex_index_t> starts = { 5, 17, 5, 2999 };
+		CHECK(parallel_bfs_shortest_path(graph, starts) == bfs_shortest_path(graph, starts));
+	}
+	SECTION("undirected")
+	{
+		using graph_t = adjacency_list<undirected, void, void, std::vector, std::vector, std::uint32_t>;
+		const std::size_t N = 2000;
+		graph_t graph(N);
+		add_random_edges(graph, 3 * N, random);
+
+		thread_pool pool(3);
+		CHECK(parallel_bfs_shortest_path(graph, 42, pool) == bfs_shortest_path(graph, 42));
+		const csr_graph csr(graph);
+		CHECK(parallel_bfs_shortest_path(csr, 42, pool) == bfs_shortest_path(graph, 42));
+	}
+}
@@ -0,0 +1,99 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+#include "../random_graph.hpp"
+using namespace quiver;
+#include <vector>
+#include <cstdint>
+
+TEST_CASE("search_workspace", "[quiver][search]")
+{
+	quiver_test::lcg random(12345);
+
+	using graph_t = adjacency_list<directed, wt<unsigned>, void>;
+	const std::size_t N = 300;
+	graph_t graph(N);
+	add_random_edges(graph, 4 * N, random, [&]{ return random(50); });
+
+	SECTION("dijkstra")
+	{
+		search_workspace<unsigned> workspace(graph);
+		for(vertex_index_t start : { 0, 7, 123, 0 }) {
+			const auto expected = dijkstra_shortest_path(graph, start);
+			auto const& result = dijkstra_shortest_path(graph, start, workspace);
+			for(vertex_index_t v = 0; v < N; ++v) {
+				REQUIRE(result.reached(v) == (expected[v].first != inf<unsigned>));
+				if(result.reached(v)) {
+					CHECK(result.distance(v) == expected[v].first);
+					if(v != start)
+						CHECK(result.distance(result.predecessor(v)) + graph.E(result.predecessor(v), v)->weight == result.distance(v));
+				}
+			}
+		}
+
+		SECTION("early exit")
+		{
+			std::size_t visits = 0;
+			CHECK(dijkstra(graph, 0, [&visits](vertex_index_t index, unsigned distance){
+				(void)distance;
+				++visits;
+				return index == 7;
+			}, workspace) == true);
+			CHECK(workspace.reached(7));
+			CHECK(workspace.distance(7) == dijkstra_shortest_path(graph, 0)[7].first);
+			std::size_t reached = 0;
+			for(vertex_index_t v = 0; v < N; ++v)
+				reached += workspace.reached(v);
+			CHECK(reached == visits);
+		}
+		SECTION("custom weights and heap")
+		{
+			search_workspace<unsigned, std::uint32_t, radix_heap_policy> radix_workspace;
+			const auto weight = [](vertex_index_t from, graph_t::out_edge_t const& edge){
+				(void)from;
+				return edge.weight + 1;
+			};
+			const auto expected = dijkstra_shortest_path(graph, 3, weight);
+			dijkstra_shortest_path(graph, 3, radix_workspace, weight);
+			for(vertex_index_t v = 0; v < N; ++v)
+				if(radix_workspace.reached(v))
+					CHECK(radix_workspace.distance(v) == expected[v].first);
+		}
+	}
+	SECTION("bfs")
+	{
+		search_workspace<> workspace;
+		for(vertex_index_t start : { 5, 6 }) {
+			const auto expected = bfs_shortest_path(graph, start);
+			bfs_shortest_path(graph, start, workspace);
+			for(vertex_index_t v = 0; v < N; ++v) {
+				REQUIRE(workspace.reached(v) == (expected[v].first != inf<bfs_path_length_t>));
+				if(workspace.reached(v)) {
+					CHECK(workspace.distance(v) == expected[v].first);
+					CHECK(workspace.predecessor(v) == expected[v].second);
+				}
+			}
+
+			std::vector<vertex_index_t> expected_order, order;
+			bfs(graph, start, [&expected_order](vertex_index_t index){ expected_order.push_back(index); return false; });
+			bfs(graph, start, [&order](vertex_index_t index){ order.push_back(index); return false; }, workspace);
+			CHECK(order == expected_order);
+		}
+	}
+	SECTION("dfs")
+	{
+		search_workspace<> workspace;
+		for(vertex_index_t start : { 5, 6 }) {
+			std::vector<vertex_index_t> expected_order, order;
+			dfs(graph, start, [&expected_order](vertex_index_t index){ expected_order.push_back(index); return false; });
+			dfs(graph, start, [&order](vertex_index_t index){ order.push_back(index); return false; }, workspace);
+			CHECK(order == expected_order);
+		}
+	}
+}
@@ -0,0 +1,62 @@
+/*
+ *	Quiver - A graph theory library
+ *	Copyright (C) 2018 Josua Rieder (josua.rieder1996@gmail.com)
+ *	Distributed under the MIT License.
+ *	See the enclosed file LICENSE.txt for further information.
+ */
+
+#include <catch2/catch.hpp>
+#include <quiver.hpp>
+using namespace quiver;
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+#include <cstddef>
+
+TEST_CASE("thread_pool", "[quiver]")
+{
+	thread_pool pool(4);
+	REQUIRE(pool.size() == 4);
+
+	SECTION("run")
+	{
+		std::vector<int> ran(pool.size(), 0);
+		for(int i = 0; i < 10; ++i)
+			pool.run([&ran](std::size_t worker){ ++ran[worker]; });
+		for(int count : ran)
+			CHECK(count == 10);
+	}
+	SECTION("parallel_for")
+	{
+		std::vector<std::atomic<int>> hits(1000);
+		pool.parallel_for(hits.size(), 7, [&hits](std::size_t worker, std::size_t begin, std::size_t end){
+			(void)worker;
+			for(std::size_t i = begin; i < end; ++i)
+				++hits[i];
+		});
+		for(auto const& hit : hits)
+			CHECK(hit == 1);
+	}
+	SECTION("exception")
+	{
+		CHECK_THROWS_AS(pool.run([](std::size_t worker){
+			if(worker == 2)
+				throw std::runtime_error("worker 2");
+		}), std::runtime_error);
+		std::atomic<std::size_t> count = 0;
+		pool.run([&count](std::size_t){ ++count; });
+		CHECK(count == pool.size());
+	}
+	SECTION("inline")
+	{
+		thread_pool single(1);
+		CHECK(single.size() == 1);
+		std::size_t sum = 0;
+		single.parallel_for(100, 8, [&sum](std::size_t worker, std::size_t begin, std::size_t end){
+			CHECK(worker == 0);
+			for(std::size_t i = begin; i < end; ++i)
+				sum += i;
+		});
+		CHECK(sum == 4950);
+	}
+}